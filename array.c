@@ -23,6 +23,7 @@ available from CTAN(ftp.shsu.edu).
 #define Visible_ARRAY
 #define Visible_CELL
 #define Visible_STRING
+#define Visible_SYMTAB
 
 #include <mawk.h>
 #include <symtype.h>
@@ -30,84 +31,364 @@ available from CTAN(ftp.shsu.edu).
 #include <split.h>
 #include <field.h>
 #include <bi_vars.h>
-
-struct anode;
-typedef struct {
-    struct anode *slink, *ilink;
-} DUAL_LINK;
+#include <code.h>
+#include <spill.h>
 
 typedef struct anode {
-    struct anode *slink;
-    struct anode *ilink;
-    STRING *sval;
-    unsigned hval;
-    Int ival;
+    STRING *sval;		/* the key, or a cached copy of ival as a string */
+    Int ival;			/* the key, unless NOT_AN_IVALUE */
     CELL cell;
 } ANODE;
 
-static ANODE *find_by_ival(ARRAY, Int, int, int *);
+/* An ARRAY table is an open-addressed table of hmask+1 slots.  Each key
+   has one canonical form: an integer, or a string which is exactly what
+   L_to_str() gives for an integer, is stored by ival, and any other string
+   by sval.  So a[1], a["1"] and a[1.0] find one node by hashing its ival,
+   without formatting the number or parsing the string stored in a node.
+   Each slot keeps the hash value of its node so that probing and
+   rehashing need not visit the node.  Collisions are resolved by linear
+   probing with Robin Hood insertion and backward-shift deletion, so a
+   probe ends at an empty slot or at one nearer its home than the probe
+   is. */
+typedef struct {
+    ANODE *node;		/* null if the slot is empty */
+    unsigned hval;		/* hash of the node's key */
+    unsigned kind;		/* what node points to */
+} SLOT;
+
+#define SLOT_NODE       0	/* an ANODE */
+#define SLOT_COUNT_INT  1	/* a CNODE keyed by an integer */
+#define SLOT_COUNT_STR  2	/* a CNODE keyed by a string */
+#define SLOT_PAIR       4	/* with the others, the integer key is a pair */
+
+#define slot_is_node(sp) (((sp)->kind & ~SLOT_PAIR) == SLOT_NODE)
+
+/* The subscript of a[i,j], when i and j are integers within PAIR_BIAS of
+   zero and SUBSEP is the default, is kept as the two packed in one Int,
+   in a node of kind SLOT_PAIR, so that matrix code neither formats nor
+   hashes the string i SUBSEP j.  That is the canonical form of such a
+   string, and find_slot() packs one given as a string, so a[1,2] and
+   a["1\0342"] are the same element and a loop gets the string back.
+   array_cat() passes the packed pair in a C_PAIR cell. */
+#define PAIR_KEYS       (sizeof(Int) >= 8)
+#define PAIR_BITS       26
+#define PAIR_BIAS       ((Int) 1 << (PAIR_BITS - 1))
+#define in_pair(i)      ((i) >= -PAIR_BIAS && (i) < PAIR_BIAS)
+#define pack_pair(i,j)  ((((i) + PAIR_BIAS) << PAIR_BITS) | ((j) + PAIR_BIAS))
+#define pair_first(p)   (((p) >> PAIR_BITS) - PAIR_BIAS)
+#define pair_second(p)  (((p) & ((PAIR_BIAS << 1) - 1)) - PAIR_BIAS)
+#define SUBSEP_CHAR     '\034'
+
+/* A count node is made by a[k]++ or a[k]-- for a new key, as in counting
+   or !seen[$0]++.  It holds just the number, in place of a cell, and a
+   string key inline, so it takes 16 bytes and the length of the key
+   rather than an ANODE and a STRING.  Reading the element copies the
+   number, and anything which needs the cell turns it into an ANODE. */
+typedef struct {
+    double dval;
+    Int key;			/* the integer key, or the length of str */
+    char str[2];
+} CNODE;
+
+#define CNODE_SIZE(len)  (offsetof(CNODE, str) + (size_t) (len))
+#define CREATE_COUNT     2	/* like CREATE, making a count node */
+#define CREATE_COPY      3	/* like CREATE, but a copy of the value will do */
+
+/* The nodes of a table are cut from blocks owned by the array, so that
+   clearing it, as "delete A" does between groups of records, frees a few
+   blocks rather than each node, and refilling it takes nodes in address
+   order.  Only ANODEs hold strings, and if there are none the nodes are
+   not visited at all.  A deleted node goes on a free list for its size,
+   in units of NODE_UNIT bytes as in zmalloc; a count node whose key would
+   make it larger than MAX_NODE is made an ANODE instead. */
+#define NODE_UNIT       8
+#define NODE_SIZES      16
+#define MAX_NODE        (NODE_UNIT * NODE_SIZES)
+#define FIRST_BLOCK     512	/* blocks double to LAST_BLOCK bytes */
+#define LAST_BLOCK      65536
+
+typedef struct node_block {
+    struct node_block *link;
+    size_t size;		/* in bytes, including this header */
+} NODE_BLOCK;
+
+typedef struct _arena {
+    NODE_BLOCK *blocks;		/* the newest first */
+    char *avail;		/* the unused end of the newest block */
+    size_t amt_avail;
+    size_t full_nodes;		/* ANODEs, which may hold strings */
+    PTR pool[NODE_SIZES];	/* deleted nodes by size */
+} ARENA;
+
+/* A split array holds the elements 1..size as ANODEs, the first limit of
+   them in the vector at ptr and the rest in banks of ABANK_SZ nodes,
+   which are allocated as a[size+1] appends to the array.  The vector and
+   each bank follow a NODE_BLOCK header, so that converting the array to
+   a table hands them to its arena rather than copying the nodes.  A cell
+   never moves, so the address of a[i] stays valid while others are added
+   and after the conversion, as a[i] = a["x"] needs. */
+#define ABANK_SZ        1024
+#define SPLIT_BLOCK(n)  (sizeof(NODE_BLOCK) + SizeTimes(n, sizeof(ANODE)))
+#define node_block(p)   ((NODE_BLOCK *) (PTR) (p) - 1)
+#define split_cell(A,i) (&split_node(A, i)->cell)
+#define STARTING_SPLIT  16	/* limit of a split array begun by a[1] */
+
+/* An array named by -W spill keeps at most limit elements in its table.
+   When that is full, the elements, and the keys deleted since the last
+   time, are written in order to a run (spill.c), and the table is
+   emptied.  An element found only in the runs is read back into the
+   table when its cell is needed, and just copied when its value is.  A
+   copy in the table is newer than any in the runs, so ondisk counts the
+   elements in the runs which are not in the table, and the array has
+   A->size + ondisk elements.  Its table is never a split array.  An
+   element whose cell is referenced from an eval stack, as a[k] is while
+   the right side of a[k] = expr is evaluated, stays in the table. */
+typedef struct _spilling {
+    size_t limit;
+    size_t ondisk;
+    ARRAY gone;			/* keys deleted since the last run, or null */
+    SPILL runs;
+} SPILLING;
 
-static ANODE *find_by_sval(ARRAY, STRING *, int, int *);
+static CELL spilled_value;	/* a copy of an element found in the runs */
+
+static SLOT *find_slot(ARRAY, CELL *, int, CELL **);
+
+static SLOT *find_by_ival(ARRAY, Int, unsigned, int);
+
+static SLOT *find_pair(ARRAY, Int, int);
+
+static SLOT *find_by_sval(ARRAY, STRING *, int);
+
+static ANODE *full_node(ARRAY, SLOT *);
 
 #define NOT_AN_IVALUE (-Max_Int-1)	/* usually 0x80000000 */
-static void add_string_associations(ARRAY);
 
-#define STARTING_HMASK    63	/* 2^6-1, must have form 2^n-1 */
-#define MAX_AVE_LIST_LENGTH   12
-#define hmask_to_limit(x) (((x)+1)*MAX_AVE_LIST_LENGTH)
-#define ahash(sval) hash2((sval)->str, (sval)->len)
+/* integers within 2^53 are exact as doubles, so a loop can give them as numbers */
+#if MAX__INT > 0x20000000000000
+#define MAX_EXACT_IVALUE ((Int) 0x20000000000000)
+#else
+#define MAX_EXACT_IVALUE Max_Int
+#endif
+#define exact_ival(i)   ((i) >= -MAX_EXACT_IVALUE && (i) <= MAX_EXACT_IVALUE)
+static int digits_to_ival(const char *, const char *, Int *);
+
+#define string_to_ival(sval, ivalp) \
+	digits_to_ival((sval)->str, (sval)->str + (sval)->len, ivalp)
+
+static int string_to_pair(const STRING *, Int *);
+
+static STRING *pair_string(Int);
+
+static STRING *double_to_key(double, Int *);
+
+static STRING *ival_string(ANODE *);
+
+static STRING *int_string(Int);
+
+#define STARTING_HMASK    15	/* 2^4-1, must have form 2^n-1 */
+#define hmask_to_limit(x) ((((size_t) (x) + 1) * 4) / 5)
+#define table_size(x)     (((size_t) (x) + 1) * sizeof(SLOT))
+#define probe_length(hval,indx,hmask) (((indx) - (hval)) & (hmask))
+#define ahash(sval) ((sval)->hval ? (sval)->hval : string_hash(sval))
+static unsigned ihash(Int);
+
+static unsigned pair_hash(Int);
+
+static SLOT *insert_slot(SLOT *, unsigned, SLOT);
+
+static void delete_slot(SLOT *, unsigned, unsigned);
+
+static void delete_node(ARRAY, SLOT *);
+
+static void free_node(ARRAY, SLOT *);
+
+static void release_node(ANODE *);
+
+static ARENA *new_arena(void);
+
+static PTR node_alloc(ARRAY, size_t);
+
+static void node_free(ARRAY, PTR, size_t);
+
+static ANODE *new_node(ARRAY);
+
+static void free_arena(ARRAY);
+
 static void make_empty_table(ARRAY, int);
 
+static ANODE *split_block(size_t);
+
+static ANODE *split_node(ARRAY, size_t);
+
+static CELL *split_append(ARRAY);
+
+static void free_banks(ARRAY);
+
+static void adopt_block(ARRAY, ANODE *, size_t, size_t);
+
 static void convert_split_array_to_table(ARRAY);
 
 static void double_the_hash_table(ARRAY);
 
+static void detach_loops(ARRAY);
+
+static void clear_table(ARRAY);
+
+static SLOT *spill_slot(ARRAY, CELL *, int, CELL **);
+
+static void spill_delete(ARRAY, CELL *);
+
+static void spill_out(ARRAY);
+
+static void spill_gather(ARRAY);
+
+static void drop_runs(SPILLING *);
+
+static void no_split(ARRAY);
+
+static void skey_cell(const SPILL_KEY *, CELL *);
+
+#define array_changes(A) \
+	do { \
+	    if ((A)->loops) \
+		detach_loops(A); \
+	} while (0)
+
 CELL *
 array_find(
 	      ARRAY A,
 	      CELL *cp,
 	      int create_flag)
 {
-    ANODE *ap;
-    int redid;
-    if (A->size == 0 && !create_flag)
+    SLOT *sp;
+    CELL *ep;
+    if (A->spill)
+	sp = spill_slot(A, cp, create_flag, &ep);
+    else if (A->size == 0 && !create_flag)
 	/* eliminating this trivial case early avoids unnecessary conversions later */
 	return (CELL *) 0;
-    switch (cp->type) {
-    case C_DOUBLE:
-	{
-	    double d = cp->dval;
-	    Int ival = d_to_I(d);
-	    if ((double) ival == d) {
-		if (A->type == AY_SPLIT) {
-		    if (ival >= 1 && ival <= (int) A->size)
-			return (CELL *) A->ptr + (ival - 1);
-		    if (!create_flag)
-			return (CELL *) 0;
-		    convert_split_array_to_table(A);
-		} else if (A->type == AY_NULL)
-		    make_empty_table(A, AY_INT);
-		ap = find_by_ival(A, ival, create_flag, &redid);
-	    } else {
-		/* convert to string */
-		char buff[260];
-		STRING *sval;
-		sprintf(buff, string(CONVFMT)->str, d);
-		sval = new_STRING(buff);
-		ap = find_by_sval(A, sval, create_flag, &redid);
-		free_STRING(sval);
-	    }
+    else
+	sp = find_slot(A, cp, create_flag, &ep);
+    if (sp == NULL)
+	return ep;
+    return &(slot_is_node(sp) ? sp->node : full_node(A, sp))->cell;
+}
+
+/* replace the index at cp by the value of A[index], creating it */
+void
+array_get(
+	     ARRAY A,
+	     CELL *cp)
+{
+    SLOT *sp;
+    CELL *ep;
+    if (A->spill)
+	sp = spill_slot(A, cp, CREATE_COPY, &ep);
+    else
+	sp = find_slot(A, cp, CREATE, &ep);
+    cell_destroy(cp);
+    if (sp == NULL) {
+	cellcpy(cp, ep);
+    } else if (slot_is_node(sp)) {
+	cellcpy(cp, &sp->node->cell);
+    } else {
+	cp->type = C_DOUBLE;
+	cp->dval = ((CNODE *) sp->node)->dval;
+    }
+}
+
+/*
+ * Add delta to A[index], where index is at cp, as a[k]++ or a[k]-- does,
+ * and return the value before.  A new element is made as a count node.
+ */
+double
+array_incdec(
+		ARRAY A,
+		CELL *cp,
+		double delta)
+{
+    SLOT *sp;
+    CELL *ep;
+    double d;
+    if (A->spill)
+	sp = spill_slot(A, cp, CREATE_COUNT, &ep);
+    else
+	sp = find_slot(A, cp, CREATE_COUNT, &ep);
+    if (sp != NULL) {
+	if (!slot_is_node(sp)) {
+	    CNODE *cn = (CNODE *) sp->node;
+	    d = cn->dval;
+	    cn->dval = d + delta;
+	    return d;
 	}
+	ep = &sp->node->cell;
+    }
+    if (ep->type != C_DOUBLE)
+	cast1_to_d(ep);
+    d = ep->dval;
+    ep->dval = d + delta;
+    return d;
+}
 
-	break;
+/*
+ * Find A[index], where index is at cp.  An element of a split array is
+ * returned in *epp, and an element of a table by its slot.  Both are null
+ * if the element is absent and create_flag is NO_CREATE.
+ */
+static SLOT *
+find_slot(
+	     ARRAY A,
+	     CELL *cp,
+	     int create_flag,
+	     CELL **epp)
+{
+    SLOT *sp;
+    Int ival;
+    STRING *sval;
+    *epp = (CELL *) 0;
+    switch (cp->type) {
+    case C_DOUBLE:
+	if ((sval = double_to_key(cp->dval, &ival)) == NULL)
+	    break;
+	sp = find_by_sval(A, sval, create_flag);
+	free_STRING(sval);
+	return sp;
     case C_NOINIT:
-	ap = find_by_sval(A, &null_str, create_flag, &redid);
-	break;
+	return find_by_sval(A, &null_str, create_flag);
+    case C_PAIR:
+	return find_pair(A, d_to_I(cp->dval), create_flag);
     default:
-	ap = find_by_sval(A, string(cp), create_flag, &redid);
-	break;
+	if (string_to_ival(string(cp), &ival))
+	    break;
+	if (string_to_pair(string(cp), &ival))
+	    return find_pair(A, ival, create_flag);
+	return find_by_sval(A, string(cp), create_flag);
+    }
+    /* the key is ival */
+    if (A->type == AY_SPLIT) {
+	if (ival >= 1 && ival <= (Int) A->size) {
+	    *epp = split_cell(A, (size_t) (ival - 1));
+	    return (SLOT *) 0;
+	}
+	if (!create_flag)
+	    return (SLOT *) 0;
+	if (ival == (Int) A->size + 1) {
+	    *epp = split_append(A);
+	    return (SLOT *) 0;
+	}
+	convert_split_array_to_table(A);
+    } else if (A->type == AY_NULL) {
+	if (ival == 1 && A->spill == NULL) {
+	    A->type = AY_SPLIT;
+	    A->limit = STARTING_SPLIT;
+	    A->ptr = (PTR) split_block(STARTING_SPLIT);
+	    *epp = split_append(A);
+	    return (SLOT *) 0;
+	}
+	make_empty_table(A, AY_INT);
     }
-    return ap ? &ap->cell : (CELL *) 0;
+    return find_by_ival(A, ival, 0, create_flag);
 }
 
 void
@@ -115,91 +396,63 @@ array_delete(
 		ARRAY A,
 		CELL *cp)
 {
-    ANODE *ap;
-    int redid;
+    SLOT *sp;
+    Int ival;
+    STRING *sval;
+    if (A->spill) {
+	spill_delete(A, cp);
+	return;
+    }
     if (A->size == 0)
 	return;
     switch (cp->type) {
     case C_DOUBLE:
-	{
-	    double d = cp->dval;
-	    Int ival = d_to_I(d);
-	    if ((double) ival == d) {
-		if (A->type == AY_SPLIT) {
-		    if (ival >= 1 && ival <= (int) A->size)
-			convert_split_array_to_table(A);
-		    else
-			return;	/* ival not in range */
-		}
-		ap = find_by_ival(A, ival, NO_CREATE, &redid);
-		if (ap) {	/* remove from the front of the ilist */
-		    DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-		    table[(unsigned) ap->ival & A->hmask].ilink = ap->ilink;
-		    if (ap->sval) {
-			ANODE *p, *q = NULL;
-			unsigned indx = (unsigned) ap->hval & A->hmask;
-			p = table[indx].slink;
-			while (p != ap) {
-			    q = p;
-			    p = q->slink;
-			}
-			if (q)
-			    q->slink = p->slink;
-			else
-			    table[indx].slink = p->slink;
-			free_STRING(ap->sval);
-		    }
-
-		    cell_destroy(&ap->cell);
-		    ZFREE(ap);
-		    if (--A->size == 0)
-			array_clear(A);
-
-		}
-		return;
-	    }
-
-	    else {		/* get the string value */
-		char buff[260];
-		STRING *sval;
-		sprintf(buff, string(CONVFMT)->str, d);
-		sval = new_STRING(buff);
-		ap = find_by_sval(A, sval, NO_CREATE, &redid);
-		free_STRING(sval);
-	    }
-	}
-	break;
+	if ((sval = double_to_key(cp->dval, &ival)) == NULL)
+	    break;
+	sp = find_by_sval(A, sval, NO_CREATE);
+	free_STRING(sval);
+	if (sp)
+	    delete_node(A, sp);
+	return;
     case C_NOINIT:
-	ap = find_by_sval(A, &null_str, NO_CREATE, &redid);
-	break;
+	sp = find_by_sval(A, &null_str, NO_CREATE);
+	if (sp)
+	    delete_node(A, sp);
+	return;
+    case C_PAIR:
+	sp = find_pair(A, d_to_I(cp->dval), NO_CREATE);
+	if (sp)
+	    delete_node(A, sp);
+	return;
     default:
-	ap = find_by_sval(A, string(cp), NO_CREATE, &redid);
-	break;
+	if (string_to_ival(string(cp), &ival))
+	    break;
+	if (string_to_pair(string(cp), &ival))
+	    sp = find_pair(A, ival, NO_CREATE);
+	else
+	    sp = find_by_sval(A, string(cp), NO_CREATE);
+	if (sp)
+	    delete_node(A, sp);
+	return;
     }
-    if (ap) {			/* remove from the front of the slist */
-	DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-	table[ap->hval & A->hmask].slink = ap->slink;
-	if (ap->ival != NOT_AN_IVALUE) {
-	    ANODE *p, *q = NULL;
-	    unsigned indx = (unsigned) ap->ival & A->hmask;
-	    p = table[indx].ilink;
-	    while (p != ap) {
-		q = p;
-		p = q->ilink;
-	    }
-	    if (q)
-		q->ilink = p->ilink;
-	    else
-		table[indx].ilink = p->ilink;
+    /* the key is ival */
+    if (A->type == AY_SPLIT) {
+	if (ival == (Int) A->size) {
+	    /* the last element goes without changing the layout */
+	    array_changes(A);
+	    cell_destroy(split_cell(A, A->size - 1));
+	    if (--A->size == 0)
+		clear_table(A);
+	    return;
 	}
-
-	free_STRING(ap->sval);
-	cell_destroy(&ap->cell);
-	ZFREE(ap);
-	if (--A->size == 0)
-	    array_clear(A);
-
+	if (ival >= 1 && ival < (Int) A->size)
+	    convert_split_array_to_table(A);
+	else
+	    return;		/* ival not in range */
     }
+    sp = find_by_ival(A, ival, 0, NO_CREATE);
+    if (sp)
+	delete_node(A, sp);
 }
 
 void
@@ -207,414 +460,1894 @@ array_load(
 	      ARRAY A,
 	      size_t cnt)
 {
+    array_changes(A);
+    if (A->spill)
+	drop_runs(A->spill);
     if (A->type != AY_SPLIT || A->limit < cnt) {
-	array_clear(A);
+	clear_table(A);
 	A->limit = (cnt & (size_t) ~3) + 4;
-	A->ptr = zmalloc(SizeTimes(A->limit, sizeof(CELL)));
+	A->ptr = (PTR) split_block(A->limit);
 	A->type = AY_SPLIT;
     } else {
 	/* reusing an existing AY_SPLIT array */
 	size_t i;
 	for (i = 0; i < A->size; i++) {
-	    cell_destroy((CELL *) A->ptr + i);
+	    cell_destroy(split_cell(A, i));
 	}
     }
 
     A->size = cnt;
-    transfer_to_array((CELL *) A->ptr, cnt);
+    transfer_to_array(split_cell(A, 0), sizeof(ANODE), cnt);
+    if (A->spill)
+	no_split(A);
 }
 
 void
 array_clear(ARRAY A)
 {
+    clear_table(A);
+    if (A->spill)
+	drop_runs(A->spill);
+}
+
+/* the number of elements, as length(A) */
+size_t
+array_length(ARRAY A)
+{
+    return A->size + (A->spill ? A->spill->ondisk : 0);
+}
+
+/* empty the table, not the runs of a spilling array */
+static void
+clear_table(ARRAY A)
+{
+    SPILLING *ps = A->spill;
     unsigned i;
-    ANODE *p, *q;
+    array_changes(A);
     if (A->type == AY_SPLIT) {
 	for (i = 0; i < A->size; i++)
-	    cell_destroy((CELL *) A->ptr + i);
-	zfree(A->ptr, A->limit * sizeof(CELL));
-    } else if (A->type & AY_STR) {
-	DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-	for (i = 0; (unsigned) i <= A->hmask; i++) {
-	    p = table[i].slink;
-	    while (p) {
-		q = p;
-		p = q->slink;
-		free_STRING(q->sval);
-		cell_destroy(&q->cell);
-		ZFREE(q);
-	    }
-	}
-	zfree(A->ptr, (A->hmask + 1) * sizeof(DUAL_LINK));
-    } else if (A->type & AY_INT) {
-	DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-	for (i = 0; (unsigned) i <= A->hmask; i++) {
-	    p = table[i].ilink;
-	    while (p) {
-		q = p;
-		p = q->ilink;
-		cell_destroy(&q->cell);
-		ZFREE(q);
+	    cell_destroy(split_cell(A, i));
+	zfree(node_block(A->ptr), node_block(A->ptr)->size);
+	free_banks(A);
+    } else if (A->type != AY_NULL) {
+	SLOT *table = (SLOT *) A->ptr;
+	for (i = 0; A->arena->full_nodes && i <= A->hmask; i++) {
+	    if (table[i].node && slot_is_node(table + i)) {
+		release_node(table[i].node);
+		A->arena->full_nodes--;
 	    }
 	}
-	zfree(A->ptr, (A->hmask + 1) * sizeof(DUAL_LINK));
+	zfree(A->ptr, table_size(A->hmask));
+	free_arena(A);
     }
     memset(A, 0, sizeof(*A));
+    A->spill = ps;
 }
 
-static int
-string_compare(
-		  const void *l,
-		  const void *r)
-{
-    STRING *const *a = (STRING * const *) l;
-    STRING *const *b = (STRING * const *) r;
-
-    return strcmp((*a)->str, (*b)->str);
-}
-
-STRING **
-array_loop_vector(
-		     ARRAY A,
-		     size_t *sizep)
-{
-    *sizep = A->size;
-    if (A->size > 0) {
-	STRING **ret;
-	if (!(A->type & AY_STR))
-	    add_string_associations(A);
-	ret = (STRING **) zmalloc(SizeTimes(A->size, sizeof(STRING *)));
-	{
-	    int r = 0;		/* indexes ret */
-	    DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-	    int i;		/* indexes table */
-	    ANODE *p;		/* walks slists */
-	    for (i = 0; (unsigned) i <= A->hmask; i++) {
-		for (p = table[i].slink; p; p = p->slink) {
-		    ret[r++] = p->sval;
-		    p->sval->ref_cnt++;
-		}
-	    }
-	}
+/* the key in a slot as a loop variable, a number if it is exact */
+static void
+slot_key(
+	    const SLOT * sp,
+	    CELL *cp)
+{
+    ANODE *p = sp->node;
+    CNODE *cn = (CNODE *) sp->node;
 
-	if (getenv("WHINY_USERS") != NULL)	/* gawk compatibility */
-	    qsort(ret, A->size, sizeof(STRING *), string_compare);
-	return ret;
+    switch (sp->kind) {
+    case SLOT_NODE | SLOT_PAIR:
+	cp->type = C_MBSTRN;
+	cp->ptr = (PTR) (p->sval ? p->sval : (p->sval = pair_string(p->ival)));
+	string(cp)->ref_cnt++;
+	break;
+    case SLOT_COUNT_INT | SLOT_PAIR:
+	cp->type = C_MBSTRN;
+	cp->ptr = (PTR) pair_string(cn->key);
+	break;
+    case SLOT_NODE:
+	if (p->ival != NOT_AN_IVALUE && exact_ival(p->ival)) {
+	    cp->type = C_DOUBLE;
+	    cp->dval = (double) p->ival;
+	} else {
+	    cp->type = C_MBSTRN;
+	    cp->ptr = (PTR) (p->sval ? p->sval : ival_string(p));
+	    string(cp)->ref_cnt++;
+	}
+	break;
+    case SLOT_COUNT_INT:
+	if (exact_ival(cn->key)) {
+	    cp->type = C_DOUBLE;
+	    cp->dval = (double) cn->key;
+	} else {
+	    cp->type = C_MBSTRN;
+	    cp->ptr = (PTR) int_string(cn->key);
+	}
+	break;
+    default:
+	cp->type = C_MBSTRN;
+	cp->ptr = (PTR) new_STRING1(cn->str, (size_t) cn->key);
+	break;
     }
-    return (STRING **) 0;
 }
 
-CELL *
-array_cat(
-	     CELL *sp,
-	     int cnt)
-{
-    CELL *p;			/* walks the eval stack */
-    CELL subsep;		/* local copy of SUBSEP */
-    size_t subsep_len;		/* string length of subsep_str */
-    char *subsep_str;
-
-    size_t total_len;		/* length of cat'ed expression */
-    CELL *top;			/* value of sp at entry */
-    char *target;		/* build cat'ed char* here */
-    STRING *sval;		/* build cat'ed STRING here */
-    cellcpy(&subsep, SUBSEP);
-    if (subsep.type < C_STRING)
-	cast1_to_s(&subsep);
-    subsep_len = string(&subsep)->len;
-    subsep_str = string(&subsep)->str;
+int array_loop_order;		/* the order of for-in loops, -W order */
 
-    assert(cnt > 0);
+/* the names of orders, as in gawk's PROCINFO["sorted_in"] */
+/* *INDENT-OFF* */
+static const struct {
+    const char name[14];
+    int order;
+} sort_orders[] = {
+    { "unsorted",      0 },
+    { "ind_str_asc",   SORT_BY_INDEX },
+    { "ind_str_desc",  SORT_BY_INDEX | SORT_DESCENDING },
+    { "ind_num_asc",   SORT_BY_INDEX | SORT_AS_NUMBER },
+    { "ind_num_desc",  SORT_BY_INDEX | SORT_AS_NUMBER | SORT_DESCENDING },
+    { "val_type_asc",  SORT_BY_VALUE | SORT_AS_TYPE },
+    { "val_type_desc", SORT_BY_VALUE | SORT_AS_TYPE | SORT_DESCENDING },
+    { "val_str_asc",   SORT_BY_VALUE },
+    { "val_str_desc",  SORT_BY_VALUE | SORT_DESCENDING },
+    { "val_num_asc",   SORT_BY_VALUE | SORT_AS_NUMBER },
+    { "val_num_desc",  SORT_BY_VALUE | SORT_AS_NUMBER | SORT_DESCENDING },
+};
+/* *INDENT-ON* */
 
-    top = sp;
-    sp -= (cnt - 1);
+/* the order with the given name, with or without a leading "@", or -1 */
+int
+array_sort_order(
+		    const char *name,
+		    size_t len)
+{
+    size_t n;
 
-    total_len = ((size_t) (cnt - 1)) * subsep_len;
-    for (p = sp; p <= top; p++) {
-	if (p->type < C_STRING)
-	    cast1_to_s(p);
-	total_len += string(p)->len;
+    if (len != 0 && *name == '@') {
+	name++;
+	len--;
     }
-
-    sval = new_STRING0(total_len);
-    target = sval->str;
-    for (p = sp; p < top; p++) {
-	memcpy(target, string(p)->str, string(p)->len);
-	target += string(p)->len;
-	memcpy(target, subsep_str, subsep_len);
-	target += subsep_len;
+    for (n = 0; n < sizeof(sort_orders) / sizeof(sort_orders[0]); n++) {
+	if (strlen(sort_orders[n].name) == len
+	    && memcmp(sort_orders[n].name, name, len) == 0)
+	    return sort_orders[n].order;
     }
-    /* now p == top */
-    memcpy(target, string(p)->str, string(p)->len);
+    return -1;
+}
 
-    for (p = sp; p <= top; p++)
-	free_STRING(string(p));
-    free_STRING(string(&subsep));
-    /* set contents of sp , sp->type > C_STRING is possible so reset */
-    sp->type = C_STRING;
-    sp->ptr = (PTR) sval;
-    return sp;
+#define SORT_PREFIX 8
 
-}
+/* an element to sort, compared by sval if that is not null, else dval */
+typedef struct {
+    STRING *sval;
+    double dval;
+    size_t n;			/* indexes the vectors of a SORTING */
+    char prefix[SORT_PREFIX];	/* the start of sval, to compare in place */
+} SORT_ITEM;
 
-static ANODE *
-find_by_ival(
-		ARRAY A,
-		Int ival,
-		int create_flag,
-		int *redo)
-{
-    DUAL_LINK *table = (DUAL_LINK *) A->ptr;
-    unsigned indx = (unsigned) ival & A->hmask;
-    ANODE *p = table[indx].ilink;	/* walks ilist */
-    ANODE *q = (ANODE *) 0;	/* trails p */
-    while (1) {
-	if (!p) {
-	    /* search failed */
-	    if (A->type & AY_STR) {
-		/* need to search by string */
-		char buff[256];
-		STRING *sval;
-		sprintf(buff, LONG_FMT, (Long) ival);
-		sval = new_STRING(buff);
-		p = find_by_sval(A, sval, create_flag, redo);
-		if (*redo) {
-		    table = (DUAL_LINK *) A->ptr;
-		}
-		free_STRING(sval);
-		if (!p)
-		    return (ANODE *) 0;
-	    } else if (create_flag) {
-		p = ZMALLOC(ANODE);
-		p->sval = (STRING *) 0;
-		p->cell.type = C_NOINIT;
-		if (++A->size > A->limit) {
-		    double_the_hash_table(A);	/* changes table, may change index */
-		    table = (DUAL_LINK *) A->ptr;
-		    indx = A->hmask & (unsigned) ival;
-		}
-	    } else
-		return (ANODE *) 0;
-	    p->ival = ival;
-	    A->type |= AY_INT;
+typedef struct {
+    int order;
+    size_t cnt;
+    CELL *keys;			/* the indices, as a for-in loop gives them */
+    CELL **cells;		/* the elements */
+    CELL *counts;		/* cells for the values of count nodes */
+    STRING **index;		/* the indices as strings, made for ties */
+    SORT_ITEM *items;		/* cnt items, and room for cnt more */
+} SORTING;
+
+/* what an element is compared by */
+static void
+sort_item(
+	     SORTING * sp,
+	     size_t n)
+{
+    SORT_ITEM *item = sp->items + n;
+    CELL c;
 
+    item->sval = (STRING *) 0;
+    item->dval = 0.0;
+    item->n = n;
+    memset(item->prefix, 0, sizeof(item->prefix));
+    cellcpy(&c, (sp->order & SORT_BY_INDEX) ? sp->keys + n : sp->cells[n]);
+    if (sp->order & SORT_AS_TYPE) {
+	if (c.type == C_MBSTRN)
+	    check_strnum(&c);
+	switch (c.type) {
+	case C_STRING:
+	    item->sval = string(&c);
 	    break;
-	} else if (p->ival == ival) {
-	    /* found it, now move to the front */
-	    if (!q)		/* already at the front */
-		return p;
-	    /* delete for insertion at the front */
-	    q->ilink = p->ilink;
+	case C_DOUBLE:
+	case C_STRNUM:
+	    item->dval = c.dval;
+	    /* FALLTHRU */
+	default:
+	    cell_destroy(&c);
 	    break;
 	}
-	q = p;
-	p = q->ilink;
+    } else if (sp->order & SORT_AS_NUMBER) {
+	cast1_to_d(&c);
+	item->dval = c.dval;
+    } else {
+	cast1_to_s(&c);
+	item->sval = string(&c);
+    }
+    if (item->sval != NULL) {
+	size_t len = item->sval->len;
+	memcpy(item->prefix, item->sval->str,
+	       (len < SORT_PREFIX) ? len : SORT_PREFIX);
     }
-    /* insert at the front */
-    p->ilink = table[indx].ilink;
-    table[indx].ilink = p;
-    return p;
 }
 
-static ANODE *
-find_by_sval(
-		ARRAY A,
-		STRING * sval,
-		int create_flag,
-		int *redo)
+static STRING *
+item_index(
+	      SORTING * sp,
+	      size_t n)
 {
-    unsigned hval = ahash(sval);
-    char *str = sval->str;
-    DUAL_LINK *table;
-    unsigned indx;
-    ANODE *p;			/* walks list */
-    ANODE *q = (ANODE *) 0;	/* trails p */
-    if (!(A->type & AY_STR))
-	add_string_associations(A);
-    table = (DUAL_LINK *) A->ptr;
-    indx = hval & A->hmask;
-    p = table[indx].slink;
-    *redo = 0;
-    while (1) {
-	if (!p) {
-	    if (create_flag) {
-		{
-		    p = ZMALLOC(ANODE);
-		    p->sval = sval;
-		    sval->ref_cnt++;
-		    p->ival = NOT_AN_IVALUE;
-		    p->hval = hval;
-		    p->cell.type = C_NOINIT;
-		    if (++A->size > A->limit) {
-			double_the_hash_table(A);	/* changes table, may change index */
-			table = (DUAL_LINK *) A->ptr;
-			indx = hval & A->hmask;
-			*redo = 1;
-		    }
-		}
+    if (sp->index[n] == NULL) {
+	CELL c;
 
-		break;
-	    }
-	    return (ANODE *) 0;
-	} else if (p->hval == hval) {
-	    if (strcmp(p->sval->str, str) == 0) {
-		/* found */
-		if (!q)		/* already at the front */
-		    return p;
-		else {		/* delete for move to the front */
-		    q->slink = p->slink;
-		    break;
-		}
-	    }
-	}
-	q = p;
-	p = q->slink;
+	cellcpy(&c, sp->keys + n);
+	cast1_to_s(&c);
+	sp->index[n] = string(&c);
     }
-    p->slink = table[indx].slink;
-    table[indx].slink = p;
-    return p;
+    return sp->index[n];
+}
+
+/* numbers precede strings, and ties are broken by the index */
+static int
+compare_items(
+		 SORTING * sp,
+		 const SORT_ITEM * a,
+		 const SORT_ITEM * b)
+{
+    int result;
+
+    if (a->sval != NULL && b->sval != NULL) {
+	/* most strings differ in the prefix, saving a cache miss */
+	result = memcmp(a->prefix, b->prefix, SORT_PREFIX);
+	if (result == 0)
+	    result = compare_strings(a->sval, b->sval);
+    }
+    else if (a->sval != NULL)
+	result = 1;
+    else if (b->sval != NULL)
+	result = -1;
+    else
+	result = (a->dval > b->dval) - (a->dval < b->dval);
+    if (result == 0)
+	result = compare_strings(item_index(sp, a->n), item_index(sp, b->n));
+    return (sp->order & SORT_DESCENDING) ? -result : result;
 }
 
+#define SORT_RUN 8		/* runs first sorted by insertion */
+
+/* a stable merge sort of the items, which are small enough to move */
 static void
-add_string_associations(ARRAY A)
+merge_sort(SORTING * sp)
 {
-    if (A->type == AY_NULL)
-	make_empty_table(A, AY_STR);
-    else {
-	DUAL_LINK *table;
-	int i;			/* walks table */
-	ANODE *p;		/* walks ilist */
-	char buff[256];
-	if (A->type == AY_SPLIT)
-	    convert_split_array_to_table(A);
-	table = (DUAL_LINK *) A->ptr;
-	for (i = 0; (unsigned) i <= A->hmask; i++) {
-	    p = table[i].ilink;
-	    while (p) {
-		sprintf(buff, LONG_FMT, (Long) p->ival);
-		p->sval = new_STRING(buff);
-		p->hval = ahash(p->sval);
-		p->slink = table[A->hmask & p->hval].slink;
-		table[A->hmask & p->hval].slink = p;
-		p = p->ilink;
+    size_t n = sp->cnt;
+    SORT_ITEM *from = sp->items;
+    SORT_ITEM *into = sp->items + n;
+    size_t width, lo, i, j, k;
+
+    for (lo = 0; lo < n; lo += SORT_RUN) {
+	size_t hi = (n - lo > SORT_RUN) ? lo + SORT_RUN : n;
+	for (i = lo + 1; i < hi; i++) {
+	    SORT_ITEM t = from[i];
+	    for (j = i; j > lo && compare_items(sp, from + j - 1, &t) > 0; j--)
+		from[j] = from[j - 1];
+	    from[j] = t;
+	}
+    }
+    for (width = SORT_RUN; width < n; width *= 2) {
+	SORT_ITEM *swap;
+	for (lo = 0; lo < n; lo += 2 * width) {
+	    size_t mid = (n - lo > width) ? lo + width : n;
+	    size_t hi = (n - mid > width) ? mid + width : n;
+	    i = lo;
+	    j = mid;
+	    k = lo;
+	    while (i < mid && j < hi) {
+		if (compare_items(sp, from + j, from + i) < 0)
+		    into[k++] = from[j++];
+		else
+		    into[k++] = from[i++];
 	    }
+	    while (i < mid)
+		into[k++] = from[i++];
+	    while (j < hi)
+		into[k++] = from[j++];
 	}
-	A->type |= AY_STR;
+	swap = from;
+	from = into;
+	into = swap;
     }
+    if (from != sp->items)
+	memcpy(sp->items, from, n * sizeof(SORT_ITEM));
 }
 
+/*
+ * Collect the elements of a nonempty array, and sort them so that item i
+ * describes the element in place i of the order.  The caller takes the
+ * keys, and frees the rest with end_sorting().
+ */
 static void
-make_empty_table(
-		    ARRAY A,
-		    int type)	/* AY_INT or AY_STR */
+sort_elements(
+		 ARRAY A,
+		 int order,
+		 SORTING * sp)
 {
-    size_t sz = (STARTING_HMASK + 1) * sizeof(DUAL_LINK);
-    A->type = (short) type;
-    A->hmask = STARTING_HMASK;
-    A->limit = hmask_to_limit(STARTING_HMASK);
-    A->ptr = memset(zmalloc(sz), 0, sz);
+    size_t cnt = A->size;
+    size_t i;
+
+    sp->order = order;
+    sp->cnt = cnt;
+    sp->keys = (CELL *) zmalloc(SizeTimes(cnt, sizeof(CELL)));
+    sp->cells = (CELL **) zmalloc(SizeTimes(cnt, sizeof(CELL *)));
+    sp->index = (STRING **) zmalloc(SizeTimes(cnt, sizeof(STRING *)));
+    sp->items = (SORT_ITEM *) zmalloc(SizeTimes(cnt, 2 * sizeof(SORT_ITEM)));
+    sp->counts = (CELL *) 0;
+    if (A->type == AY_SPLIT) {
+	for (i = 0; i < cnt; i++) {
+	    sp->keys[i].type = C_DOUBLE;
+	    sp->keys[i].dval = (double) (i + 1);
+	    sp->cells[i] = split_cell(A, i);
+	}
+    } else {
+	SLOT *table = (SLOT *) A->ptr;
+	size_t n = 0;
+	sp->counts = (CELL *) zmalloc(SizeTimes(cnt, sizeof(CELL)));
+	for (i = 0; i <= A->hmask; i++) {
+	    if (table[i].node) {
+		slot_key(table + i, sp->keys + n);
+		if (slot_is_node(table + i)) {
+		    sp->cells[n] = &table[i].node->cell;
+		} else {
+		    sp->counts[n].type = C_DOUBLE;
+		    sp->counts[n].dval = ((CNODE *) table[i].node)->dval;
+		    sp->cells[n] = sp->counts + n;
+		}
+		n++;
+	    }
+	}
+    }
+    for (i = 0; i < cnt; i++) {
+	sp->index[i] = (STRING *) 0;
+	if (order) {
+	    sort_item(sp, i);
+	} else {
+	    sp->items[i].sval = (STRING *) 0;
+	    sp->items[i].n = i;
+	}
+    }
+    if (order)
+	merge_sort(sp);
 }
 
 static void
-convert_split_array_to_table(ARRAY A)
+end_sorting(SORTING * sp)
 {
-    CELL *cells = (CELL *) A->ptr;
-    unsigned i;			/* walks cells */
-    DUAL_LINK *table;
-    unsigned j;			/* walks table */
-    size_t entry_limit = A->limit;
-    A->hmask = STARTING_HMASK;
-    A->limit = hmask_to_limit(STARTING_HMASK);
-    while (A->size > A->limit) {
-	A->hmask = (A->hmask << 1) + 1;		/* double the size */
-	A->limit = hmask_to_limit(A->hmask);
-    }
-    {
-	size_t sz = (A->hmask + 1) * sizeof(DUAL_LINK);
-	A->ptr = memset(zmalloc(sz), 0, sz);
-	table = (DUAL_LINK *) A->ptr;
-    }
+    size_t i;
 
-    /* insert each cells[i] in the new hash table on an ilist */
-    for (i = 0, j = 1; i < A->size; i++) {
-	ANODE *p = ZMALLOC(ANODE);
-	p->sval = (STRING *) 0;
-	p->ival = (Int) (i + 1);
-	p->cell = cells[i];
-	p->ilink = table[j].ilink;
-	table[j].ilink = p;
-	j++;
-	j &= A->hmask;
+    for (i = 0; i < sp->cnt; i++) {
+	if (sp->items[i].sval)
+	    free_STRING(sp->items[i].sval);
+	if (sp->index[i])
+	    free_STRING(sp->index[i]);
     }
-    A->type = AY_INT;
-    zfree(cells, entry_limit * sizeof(CELL));
+    zfree(sp->keys, sp->cnt * sizeof(CELL));
+    zfree(sp->cells, sp->cnt * sizeof(CELL *));
+    zfree(sp->index, sp->cnt * sizeof(STRING *));
+    zfree(sp->items, sp->cnt * 2 * sizeof(SORT_ITEM));
+    if (sp->counts)
+	zfree(sp->counts, sp->cnt * sizeof(CELL));
 }
 
-static void
-double_the_hash_table(ARRAY A)
+/*
+ * For asort() and asorti(), put the values or indices of src in the given
+ * order into dest[1..n], replacing what dest held.  Return n.
+ */
+size_t
+array_sort(
+	      ARRAY src,
+	      ARRAY dest,
+	      int order,
+	      int indices)
 {
-    unsigned old_hmask = A->hmask;
-    unsigned new_hmask = (old_hmask << 1) + 1;
-    DUAL_LINK *table;
-    A->ptr = zrealloc(A->ptr,
-		      (old_hmask + 1) * sizeof(DUAL_LINK),
-		      (new_hmask + 1) * sizeof(DUAL_LINK));
-    table = (DUAL_LINK *) A->ptr;
-    /* zero out the new part which is the back half */
-    memset(&table[old_hmask + 1], 0, (old_hmask + 1) * sizeof(DUAL_LINK));
-
-    if (A->type & AY_STR) {
-	unsigned i;		/* index to old lists */
-	unsigned j;		/* index to new lists */
-	ANODE *p;		/* walks an old list */
-	ANODE *q;		/* trails p for deletion */
-	ANODE *tail;		/* builds new list from the back */
-	ANODE dummy0, dummy1;
-	for (i = 0, j = old_hmask + 1; i <= old_hmask; i++, j++) {
-	    q = &dummy0;
-	    q->slink = p = table[i].slink;
-	    tail = &dummy1;
-	    while (p) {
-		if ((p->hval & new_hmask) != (unsigned) i) {	/* move it */
-		    q->slink = p->slink;
-		    tail = tail->slink = p;
-		} else
-		    q = p;
-		p = q->slink;
+    size_t cnt;
+    size_t limit = 0;
+    ANODE *nodes = (ANODE *) 0;
+
+    if (src->spill)
+	spill_gather(src);
+    cnt = src->size;
+
+    if (cnt > 0) {
+	SORTING sorting;
+	size_t i;
+
+	sort_elements(src, order, &sorting);
+	limit = (cnt & (size_t) ~3) + 4;
+	nodes = split_block(limit);
+	for (i = 0; i < cnt; i++) {
+	    size_t n = sorting.items[i].n;
+	    if (indices)
+		nodes[i].cell = sorting.keys[n];
+	    else
+		cellcpy(&nodes[i].cell, sorting.cells[n]);
+	}
+	if (!indices) {
+	    for (i = 0; i < cnt; i++)
+		cell_destroy(sorting.keys + i);
+	}
+	end_sorting(&sorting);
+    }
+    array_clear(dest);
+    if (cnt > 0) {
+	dest->ptr = (PTR) nodes;
+	dest->limit = limit;
+	dest->size = cnt;
+	dest->type = AY_SPLIT;
+	if (dest->spill)
+	    no_split(dest);
+    }
+    return cnt;
+}
+
+/* copy the keys which a loop has not yet visited */
+static void
+copy_loop_keys(ARRAY_LOOP lp)
+{
+    ARRAY A = lp->A;
+    size_t cnt = 0;
+    size_t i;
+    CELL *cp;
+
+    if (A->type == AY_SPLIT) {
+	cnt = A->size - lp->index;
+    } else {
+	SLOT *table = (SLOT *) A->ptr;
+	for (i = lp->index; i <= A->hmask; i++) {
+	    if (table[i].node)
+		cnt++;
+	}
+    }
+    lp->base = lp->ptr = lp->limit = (CELL *) 0;
+    if (cnt > 0) {
+	lp->base = lp->ptr = cp = (CELL *) zmalloc(SizeTimes(cnt, sizeof(CELL)));
+	lp->limit = lp->base + cnt;
+	if (A->type == AY_SPLIT) {
+	    for (i = lp->index; i < A->size; i++, cp++) {
+		cp->type = C_DOUBLE;
+		cp->dval = (double) (i + 1);
 	    }
-	    table[i].slink = dummy0.slink;
-	    tail->slink = (ANODE *) 0;
-	    table[j].slink = dummy1.slink;
-	}
-
-    }
-
-    if (A->type & AY_INT) {
-	unsigned i;		/* index to old lists */
-	unsigned j;		/* index to new lists */
-	ANODE *p;		/* walks an old list */
-	ANODE *q;		/* trails p for deletion */
-	ANODE *tail;		/* builds new list from the back */
-	ANODE dummy0, dummy1;
-	for (i = 0, j = old_hmask + 1; i <= old_hmask; i++, j++) {
-	    q = &dummy0;
-	    q->ilink = p = table[i].ilink;
-	    tail = &dummy1;
-	    while (p) {
-		if (((unsigned) p->ival & new_hmask) != i) {	/* move it */
-		    q->ilink = p->ilink;
-		    tail = tail->ilink = p;
-		} else
-		    q = p;
-		p = q->ilink;
+	} else {
+	    SLOT *table = (SLOT *) A->ptr;
+	    for (i = lp->index; i <= A->hmask; i++) {
+		if (table[i].node)
+		    slot_key(table + i, cp++);
+	    }
+	}
+    }
+    lp->A = (ARRAY) 0;
+}
+
+/* the array is about to change, so its loops stop walking it */
+static void
+detach_loops(ARRAY A)
+{
+    ARRAY_LOOP lp;
+
+    while ((lp = A->loops) != NULL) {
+	A->loops = lp->link;
+	copy_loop_keys(lp);
+    }
+}
+
+/*
+ * A for-in loop walks the table, or the elements of a split array, as it
+ * goes, so it neither copies the keys nor formats integer keys, which are
+ * given to the loop variable as numbers.  Before anything changes the
+ * layout of an array, each loop walking it copies the keys it has not yet
+ * visited and continues with the copy, so a loop visits exactly the keys
+ * present when it started, as if they had all been copied then.  A
+ * sorted loop, for -W order or WHINY_USERS, does copy the keys.
+ */
+ARRAY_LOOP
+array_loop_open(ARRAY A)
+{
+    ARRAY_LOOP lp = ZMALLOC(struct _array_loop);
+
+    lp->A = (ARRAY) 0;
+    lp->index = 0;
+    lp->base = lp->ptr = lp->limit = (CELL *) 0;
+    lp->stream = (SPILL_STREAM) 0;
+    if (array_length(A) > 0) {
+	int order = array_loop_order;
+
+	if (order == 0 && getenv("WHINY_USERS") != NULL)	/* gawk compatibility */
+	    order = SORT_BY_INDEX;
+	if (order != 0) {
+	    /* a sorted loop visits a copy of the keys */
+	    SORTING sorting;
+	    size_t i;
+
+	    if (A->spill)
+		spill_gather(A);
+	    sort_elements(A, order, &sorting);
+	    lp->base = lp->ptr = (CELL *) zmalloc(SizeTimes(A->size, sizeof(CELL)));
+	    lp->limit = lp->base + A->size;
+	    for (i = 0; i < A->size; i++)
+		lp->base[i] = sorting.keys[sorting.items[i].n];
+	    end_sorting(&sorting);
+	} else if (A->spill && spill_runs(A->spill->runs) != 0) {
+	    /* with the table written out too, the runs hold every key */
+	    spill_out(A);
+	    lp->stream = spill_open(A->spill->runs);
+	} else {
+	    lp->A = A;
+	    lp->link = A->loops;
+	    A->loops = lp;
+	}
+    }
+    return lp;
+}
+
+/* put the next key in *cp, returning 0 at the end of the loop */
+int
+array_loop_next(
+		   ARRAY_LOOP lp,
+		   CELL *cp)
+{
+    ARRAY A = lp->A;
+
+    if (lp->stream != NULL) {
+	SPILL_KEY key;
+	if (spill_next(lp->stream, &key, (CELL *) 0)) {
+	    skey_cell(&key, cp);
+	    return 1;
+	}
+    } else if (A == NULL) {
+	if (lp->ptr < lp->limit) {
+	    *cp = *lp->ptr++;
+	    return 1;
+	}
+    } else if (A->type == AY_SPLIT) {
+	if (lp->index < A->size) {
+	    cp->type = C_DOUBLE;
+	    cp->dval = (double) ++lp->index;
+	    return 1;
+	}
+    } else {
+	SLOT *table = (SLOT *) A->ptr;
+	while (lp->index <= A->hmask) {
+	    SLOT *sp = table + lp->index++;
+	    if (sp->node != NULL) {
+		slot_key(sp, cp);
+		return 1;
 	    }
-	    table[i].ilink = dummy0.ilink;
-	    tail->ilink = (ANODE *) 0;
-	    table[j].ilink = dummy1.ilink;
 	}
+    }
+    return 0;
+}
+
+void
+array_loop_close(ARRAY_LOOP lp)
+{
+    if (lp->A != NULL) {
+	ARRAY_LOOP *q = &lp->A->loops;
+	while (*q != lp)
+	    q = &(*q)->link;
+	*q = lp->link;
+    }
+    while (lp->ptr < lp->limit) {
+	cell_destroy(lp->ptr);
+	lp->ptr++;
+    }
+    if (lp->base != NULL)
+	zfree(lp->base, (size_t) (lp->limit - lp->base) * sizeof(CELL));
+    if (lp->stream != NULL)
+	spill_close(lp->stream);
+    ZFREE(lp);
+}
+
+/* can the subscript be one half of a pair?  Its string form is an integer */
+static int
+pair_part(
+	     const CELL *cp,
+	     Int * ip)
+{
+    switch (cp->type) {
+    case C_DOUBLE:
+	*ip = d_to_I(cp->dval);
+	if ((double) *ip != cp->dval)
+	    return 0;
+	break;
+    case C_STRING:
+    case C_STRNUM:
+    case C_MBSTRN:
+	if (!string_to_ival(string(cp), ip))
+	    return 0;
+	break;
+    default:
+	return 0;
+    }
+    return in_pair(*ip);
+}
+
+/*
+ * Join the cnt subscripts at the top of the stack, as for a[i,j].  Two
+ * integers joined by the default SUBSEP become a C_PAIR instead of the
+ * string.
+ */
+CELL *
+array_cat(
+	     CELL *sp,
+	     int cnt)
+{
+    CELL *p;			/* walks the eval stack */
+    CELL subsep;		/* local copy of SUBSEP */
+    size_t subsep_len;		/* string length of subsep_str */
+    char *subsep_str;
+
+    size_t total_len;		/* length of cat'ed expression */
+    CELL *top;			/* value of sp at entry */
+    char *target;		/* build cat'ed char* here */
+    STRING *sval;		/* build cat'ed STRING here */
+    if (cnt == 2 && PAIR_KEYS
+	&& SUBSEP->type >= C_STRING && SUBSEP->type <= C_MBSTRN
+	&& string(SUBSEP)->len == 1
+	&& string(SUBSEP)->str[0] == SUBSEP_CHAR) {
+	Int i, j;
+	if (pair_part(sp - 1, &i) && pair_part(sp, &j)) {
+	    cell_destroy(sp);
+	    sp--;
+	    cell_destroy(sp);
+	    sp->type = C_PAIR;
+	    sp->dval = (double) pack_pair(i, j);
+	    return sp;
+	}
+    }
+
+    cellcpy(&subsep, SUBSEP);
+    if (subsep.type < C_STRING)
+	cast1_to_s(&subsep);
+    subsep_len = string(&subsep)->len;
+    subsep_str = string(&subsep)->str;
+
+    assert(cnt > 0);
+
+    top = sp;
+    sp -= (cnt - 1);
+
+    total_len = ((size_t) (cnt - 1)) * subsep_len;
+    for (p = sp; p <= top; p++) {
+	if (p->type < C_STRING)
+	    cast1_to_s(p);
+	total_len += string(p)->len;
+    }
+
+    sval = new_STRING0(total_len);
+    target = sval->str;
+    for (p = sp; p < top; p++) {
+	memcpy(target, string(p)->str, string(p)->len);
+	target += string(p)->len;
+	memcpy(target, subsep_str, subsep_len);
+	target += subsep_len;
+    }
+    /* now p == top */
+    memcpy(target, string(p)->str, string(p)->len);
+
+    for (p = sp; p <= top; p++)
+	free_STRING(string(p));
+    free_STRING(string(&subsep));
+    /* set contents of sp , sp->type > C_STRING is possible so reset */
+    sp->type = C_STRING;
+    sp->ptr = (PTR) sval;
+    return sp;
+
+}
+
+/* Fold the high bits of an integer key into the low ones, so that keys
+   with a power-of-two stride spread out, while a run of consecutive keys
+   still lands in mostly consecutive slots. */
+static unsigned
+ihash(Int ival)
+{
+    unsigned h = (unsigned) ival ^ (unsigned) (((ULong) ival >> 16) >> 16);
+    return h ^ (h >> 5) ^ (h >> 11) ^ (h >> 19);
+}
+
+/* mix both halves, so a row or a column of a matrix spreads */
+static unsigned
+pair_hash(Int pair)
+{
+    unsigned h = ((unsigned) (pair >> PAIR_BITS) * 0x9E3779B1U
+		  + (unsigned) pair);
+    h ^= h >> 15;
+    h *= 0x85EBCA77U;
+    return h ^ (h >> 13);
+}
+
+/* put a node, known to be absent, into one of the tables, returning
+   the slot where it lands */
+static SLOT *
+insert_slot(
+	       SLOT * table,
+	       unsigned hmask,
+	       SLOT carry)
+{
+    unsigned indx = carry.hval & hmask;
+    unsigned dist = 0;		/* probe length of the carried node */
+    SLOT *result = (SLOT *) 0;
+    while (table[indx].node) {
+	unsigned d = probe_length(table[indx].hval, indx, hmask);
+	if (d < dist) {
+	    /* the resident is nearer its home, so it moves on instead */
+	    SLOT t = table[indx];
+	    table[indx] = carry;
+	    carry = t;
+	    dist = d;
+	    if (result == NULL)
+		result = table + indx;
+	}
+	indx = (indx + 1) & hmask;
+	dist++;
+    }
+    table[indx] = carry;
+    return result ? result : table + indx;
+}
+
+/* empty the slot at indx, closing the gap it leaves */
+static void
+delete_slot(
+	       SLOT * table,
+	       unsigned hmask,
+	       unsigned indx)
+{
+    unsigned next = (indx + 1) & hmask;
+    while (table[next].node
+	   && probe_length(table[next].hval, next, hmask) != 0) {
+	table[indx] = table[next];
+	indx = next;
+	next = (next + 1) & hmask;
+    }
+    table[indx].node = (ANODE *) 0;
+}
+
+static void
+delete_node(
+	       ARRAY A,
+	       SLOT * sp)
+{
+    SLOT s = *sp;
+    array_changes(A);
+    delete_slot((SLOT *) A->ptr, A->hmask, (unsigned) (sp - (SLOT *) A->ptr));
+    free_node(A, &s);
+    if (--A->size == 0)
+	clear_table(A);
+}
+
+static void
+free_node(
+	     ARRAY A,
+	     SLOT * sp)
+{
+    if (slot_is_node(sp)) {
+	release_node(sp->node);
+	node_free(A, sp->node, sizeof(ANODE));
+	A->arena->full_nodes--;
+    } else {
+	CNODE *cn = (CNODE *) sp->node;
+	node_free(A, cn, CNODE_SIZE(sp->kind == SLOT_COUNT_STR ? cn->key : 0));
+    }
+}
+
+/* drop the strings an ANODE holds */
+static void
+release_node(ANODE * p)
+{
+    if (p->sval)
+	free_STRING(p->sval);
+    cell_destroy(&p->cell);
+}
+
+/* the cell of a count node is needed, so it becomes an ANODE */
+static ANODE *
+full_node(
+	     ARRAY A,
+	     SLOT * sp)
+{
+    CNODE *cn = (CNODE *) sp->node;
+    ANODE *p = new_node(A);
+
+    p->cell.type = C_DOUBLE;
+    p->cell.dval = cn->dval;
+    if (sp->kind == SLOT_COUNT_STR) {
+	p->sval = new_STRING1(cn->str, (size_t) cn->key);
+	p->sval->hval = sp->hval;
+	p->ival = NOT_AN_IVALUE;
+	node_free(A, cn, CNODE_SIZE(cn->key));
+    } else {
+	p->sval = (STRING *) 0;
+	p->ival = cn->key;
+	node_free(A, cn, CNODE_SIZE(0));
+    }
+    sp->node = p;
+    sp->kind = SLOT_NODE | (sp->kind & SLOT_PAIR);
+    return p;
+}
+
+static ARENA *
+new_arena(void)
+{
+    return (ARENA *) memset(ZMALLOC(ARENA), 0, sizeof(ARENA));
+}
+
+static PTR
+node_alloc(
+	      ARRAY A,
+	      size_t size)
+{
+    ARENA *ap = A->arena;
+    size_t units = (size + NODE_UNIT - 1) / NODE_UNIT;
+    PTR p;
+
+    if ((p = ap->pool[units - 1]) != NULL) {
+	ap->pool[units - 1] = *(PTR *) p;
+	return p;
+    }
+    size = units * NODE_UNIT;
+    if (size > ap->amt_avail) {
+	size_t sz = ap->blocks ? 2 * ap->blocks->size : FIRST_BLOCK;
+	NODE_BLOCK *bp;
+
+	if (sz > LAST_BLOCK)
+	    sz = LAST_BLOCK;
+	if (ap->amt_avail)	/* keep the end of the old block */
+	    node_free(A, ap->avail, ap->amt_avail);
+	bp = (NODE_BLOCK *) zmalloc(sz);
+	bp->link = ap->blocks;
+	bp->size = sz;
+	ap->blocks = bp;
+	ap->avail = (char *) (bp + 1);
+	ap->amt_avail = sz - sizeof(NODE_BLOCK);
+    }
+    p = ap->avail;
+    ap->avail += size;
+    ap->amt_avail -= size;
+    return p;
+}
+
+static void
+node_free(
+	     ARRAY A,
+	     PTR p,
+	     size_t size)
+{
+    ARENA *ap = A->arena;
+    size_t units = (size + NODE_UNIT - 1) / NODE_UNIT;
+
+    *(PTR *) p = ap->pool[units - 1];
+    ap->pool[units - 1] = p;
+}
+
+static ANODE *
+new_node(ARRAY A)
+{
+    A->arena->full_nodes++;
+    return (ANODE *) node_alloc(A, sizeof(ANODE));
+}
+
+/* the nodes go with their blocks */
+static void
+free_arena(ARRAY A)
+{
+    ARENA *ap = A->arena;
+
+    while (ap->blocks) {
+	NODE_BLOCK *bp = ap->blocks;
+	ap->blocks = bp->link;
+	zfree(bp, bp->size);
+    }
+    ZFREE(ap);
+}
+
+/*
+ * If the text s..limit is the canonical form of an integer key, i.e., what
+ * L_to_str() writes, with no sign other than a leading '-', no leading
+ * zeros and no "-0", return true and store the integer.
+ */
+static int
+digits_to_ival(
+		  const char *s,
+		  const char *limit,
+		  Int * ivalp)
+{
+    int neg = 0;
+    Int ival = 0;
+
+    if (s < limit && *s == '-') {
+	neg = 1;
+	s++;
+    }
+    if (s == limit || *s < '0' || *s > '9')
+	return 0;
+    if (*s == '0') {
+	if (neg || s + 1 != limit)
+	    return 0;
+    }
+    while (s < limit) {
+	int d = *s++ - '0';
+	if (d < 0 || d > 9 || ival > (Max_Int - d) / 10)
+	    return 0;
+	ival = ival * 10 + d;
+    }
+    *ivalp = neg ? -ival : ival;
+    return 1;
+}
+
+/* is the string the canonical form of a pair, i SUBSEP j? */
+static int
+string_to_pair(
+		  const STRING * sval,
+		  Int * pairp)
+{
+    const char *s = sval->str;
+    const char *limit = s + sval->len;
+    const char *sep;
+    Int i, j;
+
+    if (!PAIR_KEYS
+	|| sval->len < 3
+	|| (*s != '-' && (*s < '0' || *s > '9'))
+	|| (sep = memchr(s, SUBSEP_CHAR, sval->len)) == NULL
+	|| !digits_to_ival(s, sep, &i)
+	|| !digits_to_ival(sep + 1, limit, &j)
+	|| !in_pair(i)
+	|| !in_pair(j))
+	return 0;
+    *pairp = pack_pair(i, j);
+    return 1;
+}
+
+/* the string i SUBSEP j which a pair stands for */
+static STRING *
+pair_string(Int pair)
+{
+    char buff[512];
+    size_t len = L_to_str((Long) pair_first(pair), buff);
+
+    buff[len++] = SUBSEP_CHAR;
+    len += L_to_str((Long) pair_second(pair), buff + len);
+    return new_STRING1(buff, len);
+}
+
+/*
+ * Return the string key for a double, or null if the key is an integer,
+ * stored in *ivalp.  The one integer equal to NOT_AN_IVALUE is kept by
+ * its string form.
+ */
+static STRING *
+double_to_key(
+		 double d,
+		 Int * ivalp)
+{
+    char buff[260];
+    Int ival = d_to_I(d);
+    STRING *sval;
+
+    if ((double) ival == d) {
+	if (ival != NOT_AN_IVALUE) {
+	    *ivalp = ival;
+	    return (STRING *) 0;
+	}
+	sprintf(buff, "%.0f", d);	/* L_to_str() cannot negate it */
+	sval = new_STRING(buff);
+    } else {
+	sprintf(buff, string(CONVFMT)->str, d);
+	sval = new_STRING(buff);
+	if (string_to_ival(sval, ivalp)) {
+	    free_STRING(sval);
+	    return (STRING *) 0;
+	}
+    }
+    return sval;
+}
+
+/* the string form of an integer key, made when first needed */
+static STRING *
+ival_string(ANODE *p)
+{
+    char buff[256];
+    return p->sval = new_STRING1(buff, L_to_str((Long) p->ival, buff));
+}
+
+/* the string form of an integer key of a count node */
+static STRING *
+int_string(Int ival)
+{
+    char buff[256];
+    return new_STRING1(buff, L_to_str((Long) ival, buff));
+}
+
+#define slot_ival(sp,pair) ((sp)->kind == (SLOT_NODE | (pair)) \
+			    ? (sp)->node->ival \
+			    : ((sp)->kind == (SLOT_COUNT_INT | (pair)) \
+			       ? ((CNODE *) (sp)->node)->key \
+			       : NOT_AN_IVALUE))
+
+static int
+slot_has_sval(
+		 const SLOT * sp,
+		 const STRING * sval)
+{
+    if (sp->kind == SLOT_NODE) {
+	ANODE *p = sp->node;
+	return (p->ival == NOT_AN_IVALUE
+		&& p->sval->len == sval->len
+		&& memcmp(p->sval->str, sval->str, sval->len) == 0);
+    } else if (sp->kind == SLOT_COUNT_STR) {
+	CNODE *cn = (CNODE *) sp->node;
+	return ((size_t) cn->key == sval->len
+		&& memcmp(cn->str, sval->str, sval->len) == 0);
+    }
+    return 0;
+}
+
+static SLOT *
+find_by_ival(
+		ARRAY A,
+		Int ival,
+		unsigned pair,	/* SLOT_PAIR if ival is a packed pair */
+		int create_flag)
+{
+    unsigned hval = pair ? pair_hash(ival) : ihash(ival);
+    SLOT *table = (SLOT *) A->ptr;
+    unsigned indx = hval & A->hmask;
+    unsigned dist = 0;
+    SLOT s;
+    while (table[indx].node != NULL
+	   && probe_length(table[indx].hval, indx, A->hmask) >= dist) {
+	if (table[indx].hval == hval && slot_ival(table + indx, pair) == ival)
+	    return table + indx;
+	indx = (indx + 1) & A->hmask;
+	dist++;
+    }
+    /* search failed */
+    if (!create_flag)
+	return (SLOT *) 0;
+    array_changes(A);
+    if (create_flag == CREATE_COUNT) {
+	CNODE *cn = (CNODE *) node_alloc(A, CNODE_SIZE(0));
+	cn->dval = 0.0;
+	cn->key = ival;
+	s.node = (ANODE *) cn;
+	s.kind = SLOT_COUNT_INT | pair;
+    } else {
+	ANODE *p = new_node(A);
+	p->sval = (STRING *) 0;
+	p->ival = ival;
+	p->cell.type = C_NOINIT;
+	s.node = p;
+	s.kind = SLOT_NODE | pair;
+    }
+    s.hval = hval;
+    A->type |= pair ? AY_STR : AY_INT;
+    if (++A->size > A->limit)
+	double_the_hash_table(A);
+    return insert_slot((SLOT *) A->ptr, A->hmask, s);
+}
+
+/* a pair is a string key, as far as the layout of the array goes */
+static SLOT *
+find_pair(
+	     ARRAY A,
+	     Int pair,
+	     int create_flag)
+{
+    if (A->type == AY_NULL)
+	make_empty_table(A, AY_STR);
+    else if (A->type == AY_SPLIT) {
+	if (!create_flag)
+	    return (SLOT *) 0;
+	convert_split_array_to_table(A);
+    }
+    return find_by_ival(A, pair, SLOT_PAIR, create_flag);
+}
+
+/* the string must not be the canonical form of an integer */
+static SLOT *
+find_by_sval(
+		ARRAY A,
+		STRING * sval,
+		int create_flag)
+{
+    unsigned hval = ahash(sval);
+    SLOT *table;
+    unsigned indx;
+    unsigned dist = 0;
+    SLOT s;
+    if (A->type == AY_NULL)
+	make_empty_table(A, AY_STR);
+    else if (A->type == AY_SPLIT) {
+	if (!create_flag)
+	    return (SLOT *) 0;	/* a split array has only integer keys */
+	convert_split_array_to_table(A);
+    }
+    table = (SLOT *) A->ptr;
+    indx = hval & A->hmask;
+    while (table[indx].node != NULL
+	   && probe_length(table[indx].hval, indx, A->hmask) >= dist) {
+	if (table[indx].hval == hval && slot_has_sval(table + indx, sval))
+	    return table + indx;
+	indx = (indx + 1) & A->hmask;
+	dist++;
+    }
+    if (!create_flag)
+	return (SLOT *) 0;
+    array_changes(A);
+    if (create_flag == CREATE_COUNT && CNODE_SIZE(sval->len) <= MAX_NODE) {
+	CNODE *cn = (CNODE *) node_alloc(A, CNODE_SIZE(sval->len));
+	cn->dval = 0.0;
+	cn->key = (Int) sval->len;
+	memcpy(cn->str, sval->str, sval->len);
+	s.node = (ANODE *) cn;
+	s.kind = SLOT_COUNT_STR;
+    } else {
+	ANODE *p = new_node(A);
+	p->sval = sval;
+	sval->ref_cnt++;
+	p->ival = NOT_AN_IVALUE;
+	p->cell.type = C_NOINIT;
+	s.node = p;
+	s.kind = SLOT_NODE;
+    }
+    s.hval = hval;
+    A->type |= AY_STR;
+    if (++A->size > A->limit)
+	double_the_hash_table(A);
+    return insert_slot((SLOT *) A->ptr, A->hmask, s);
+}
+
+static void
+make_empty_table(
+		    ARRAY A,
+		    int type)	/* AY_INT or AY_STR */
+{
+    size_t sz = table_size(STARTING_HMASK);
+    A->type = (short) type;
+    A->hmask = STARTING_HMASK;
+    A->limit = hmask_to_limit(STARTING_HMASK);
+    A->ptr = memset(zmalloc(sz), 0, sz);
+    A->arena = new_arena();
+}
+
+/* a vector of n nodes for a split array, after its NODE_BLOCK */
+static ANODE *
+split_block(size_t n)
+{
+    NODE_BLOCK *bp = (NODE_BLOCK *) zmalloc(SPLIT_BLOCK(n));
+
+    bp->link = (NODE_BLOCK *) 0;
+    bp->size = SPLIT_BLOCK(n);
+    return (ANODE *) (bp + 1);
+}
+
+/* the node of a[i+1] in a split array */
+static ANODE *
+split_node(
+	      ARRAY A,
+	      size_t i)
+{
+    if (i < A->limit)
+	return (ANODE *) A->ptr + i;
+    i -= A->limit;
+    return A->banks[i / ABANK_SZ] + i % ABANK_SZ;
+}
+
+/* add a[size+1] to a split array */
+static CELL *
+split_append(ARRAY A)
+{
+    size_t i = A->size;
+    ANODE *p;
+
+    array_changes(A);
+    if (i < A->limit) {
+	p = (ANODE *) A->ptr + i;
+    } else {
+	size_t b = (i - A->limit) / ABANK_SZ;
+	if (b >= A->nbanks) {
+	    size_t n = A->nbanks ? 2 * A->nbanks : 4;
+	    size_t sz = SizeTimes(n, sizeof(ANODE *));
+	    if (A->nbanks)
+		A->banks = (ANODE **) zrealloc(A->banks,
+					       A->nbanks * sizeof(ANODE *), sz);
+	    else
+		A->banks = (ANODE **) zmalloc(sz);
+	    memset(A->banks + A->nbanks, 0, (n - A->nbanks) * sizeof(ANODE *));
+	    A->nbanks = n;
+	}
+	if (A->banks[b] == NULL)
+	    A->banks[b] = split_block(ABANK_SZ);
+	p = A->banks[b] + (i - A->limit) % ABANK_SZ;
+    }
+    A->size++;
+    p->cell.type = C_NOINIT;
+    return &p->cell;
+}
+
+static void
+free_banks(ARRAY A)
+{
+    size_t b;
 
+    for (b = 0; b < A->nbanks; b++) {
+	if (A->banks[b])
+	    zfree(node_block(A->banks[b]), SPLIT_BLOCK(ABANK_SZ));
+    }
+    if (A->nbanks)
+	zfree(A->banks, A->nbanks * sizeof(ANODE *));
+    A->banks = (ANODE **) 0;
+    A->nbanks = 0;
+}
+
+/* give the arena a block of n nodes, of which those from used on are free */
+static void
+adopt_block(
+	       ARRAY A,
+	       ANODE * p,
+	       size_t n,
+	       size_t used)
+{
+    ARENA *ap = A->arena;
+    NODE_BLOCK *bp = node_block(p);
+
+    bp->link = ap->blocks;
+    ap->blocks = bp;
+    while (n > used)
+	node_free(A, p + --n, sizeof(ANODE));
+}
+
+static void
+convert_split_array_to_table(ARRAY A)
+{
+    unsigned hmask = STARTING_HMASK;
+    SLOT *table;
+    size_t b;
+    unsigned i;			/* walks nodes */
+    array_changes(A);
+    while (A->size > hmask_to_limit(hmask))
+	hmask = (hmask << 1) + 1;	/* double the size */
+    {
+	size_t sz = table_size(hmask);
+	table = memset(zmalloc(sz), 0, sz);
+    }
+
+    /* insert each node in the new table */
+    for (i = 0; i < A->size; i++) {
+	ANODE *p = split_node(A, i);
+	SLOT s;
+	p->sval = (STRING *) 0;
+	p->ival = (Int) (i + 1);
+	s.node = p;
+	s.hval = ihash(p->ival);
+	s.kind = SLOT_NODE;
+	insert_slot(table, hmask, s);
+    }
+
+    /* the nodes stay where they are, in blocks of the new arena */
+    A->arena = new_arena();
+    A->arena->full_nodes = A->size;
+    adopt_block(A, (ANODE *) A->ptr, A->limit,
+		A->size < A->limit ? A->size : A->limit);
+    for (b = 0; b < A->nbanks; b++) {
+	if (A->banks[b]) {
+	    size_t first = A->limit + b * ABANK_SZ;
+	    size_t used = A->size > first ? A->size - first : 0;
+	    adopt_block(A, A->banks[b], ABANK_SZ,
+			used < ABANK_SZ ? used : ABANK_SZ);
+	}
     }
+    if (A->nbanks)
+	zfree(A->banks, A->nbanks * sizeof(ANODE *));
+    A->banks = (ANODE **) 0;
+    A->nbanks = 0;
 
+    A->ptr = (PTR) table;
+    A->hmask = hmask;
+    A->limit = hmask_to_limit(hmask);
+    A->type = AY_INT;
+}
+
+static void
+double_the_hash_table(ARRAY A)
+{
+    unsigned old_hmask = A->hmask;
+    unsigned new_hmask = (old_hmask << 1) + 1;
+    SLOT *old = (SLOT *) A->ptr;
+    size_t sz = table_size(new_hmask);
+    unsigned i;
+
+    A->ptr = memset(zmalloc(sz), 0, sz);
     A->hmask = new_hmask;
     A->limit = hmask_to_limit(new_hmask);
+
+    /* the slots carry their hash values, so the nodes are not visited */
+    for (i = 0; i <= old_hmask; i++) {
+	if (old[i].node)
+	    insert_slot((SLOT *) A->ptr, new_hmask, old[i]);
+    }
+    zfree(old, table_size(old_hmask));
+}
+
+/* the canonical key of the subscript at cp, as find_slot() finds it; a
+   string made for it is returned, to be freed after the key is used */
+static STRING *
+cell_skey(
+	     CELL *cp,
+	     SPILL_KEY * kp)
+{
+    STRING *sval;
+    STRING *made = (STRING *) 0;
+    Int ival;
+
+    kp->str = (const char *) 0;
+    kp->len = 0;
+    switch (cp->type) {
+    case C_DOUBLE:
+	if ((sval = made = double_to_key(cp->dval, &ival)) == NULL) {
+	    kp->kind = SKEY_INT;
+	    kp->ival = ival;
+	    kp->hval = ihash(ival);
+	    return made;
+	}
+	break;
+    case C_NOINIT:
+	sval = &null_str;
+	break;
+    case C_PAIR:
+	kp->kind = SKEY_PAIR;
+	kp->ival = d_to_I(cp->dval);
+	kp->hval = pair_hash(kp->ival);
+	return made;
+    default:
+	sval = string(cp);
+	if (string_to_ival(sval, &ival)) {
+	    kp->kind = SKEY_INT;
+	    kp->ival = ival;
+	    kp->hval = ihash(ival);
+	    return made;
+	}
+	if (string_to_pair(sval, &ival)) {
+	    kp->kind = SKEY_PAIR;
+	    kp->ival = ival;
+	    kp->hval = pair_hash(ival);
+	    return made;
+	}
+	break;
+    }
+    kp->kind = SKEY_STR;
+    kp->ival = 0;
+    kp->hval = ahash(sval);
+    kp->str = sval->str;
+    kp->len = sval->len;
+    return made;
+}
+
+/* the key of the node in a slot */
+static void
+slot_skey(
+	     const SLOT * sp,
+	     SPILL_KEY * kp)
+{
+    int kind = (sp->kind & SLOT_PAIR) ? SKEY_PAIR : SKEY_INT;
+
+    kp->hval = sp->hval;
+    kp->kind = kind;
+    kp->str = (const char *) 0;
+    kp->len = 0;
+    if (slot_is_node(sp)) {
+	ANODE *p = sp->node;
+	if ((kp->ival = p->ival) == NOT_AN_IVALUE) {
+	    kp->kind = SKEY_STR;
+	    kp->ival = 0;
+	    kp->str = p->sval->str;
+	    kp->len = p->sval->len;
+	}
+    } else {
+	CNODE *cn = (CNODE *) sp->node;
+	if (sp->kind == SLOT_COUNT_STR) {
+	    kp->kind = SKEY_STR;
+	    kp->ival = 0;
+	    kp->str = cn->str;
+	    kp->len = (size_t) cn->key;
+	} else {
+	    kp->ival = cn->key;
+	}
+    }
+}
+
+/* a key from the runs as a loop variable, as slot_key() gives it */
+static void
+skey_cell(
+	     const SPILL_KEY * kp,
+	     CELL *cp)
+{
+    switch (kp->kind) {
+    case SKEY_PAIR:
+	cp->type = C_MBSTRN;
+	cp->ptr = (PTR) pair_string(kp->ival);
+	break;
+    case SKEY_INT:
+	if (exact_ival(kp->ival)) {
+	    cp->type = C_DOUBLE;
+	    cp->dval = (double) kp->ival;
+	} else {
+	    cp->type = C_MBSTRN;
+	    cp->ptr = (PTR) int_string(kp->ival);
+	}
+	break;
+    default:
+	cp->type = C_MBSTRN;
+	cp->ptr = (PTR) new_STRING1(kp->str, kp->len);
+	break;
+    }
+}
+
+/* is the subscript at cp one of the keys deleted since the last run? */
+static int
+is_gone(
+	   SPILLING * ps,
+	   CELL *cp)
+{
+    CELL *ep;
+
+    return (ps->gone != NULL
+	    && ps->gone->size != 0
+	    && (find_slot(ps->gone, cp, NO_CREATE, &ep) != NULL || ep != NULL));
+}
+
+/* is A[index], where index is at cp, in the runs?  Its value goes in *vp */
+static int
+in_runs(
+	   SPILLING * ps,
+	   CELL *cp,
+	   CELL *vp)
+{
+    SPILL_KEY key;
+    STRING *made;
+    int found;
+
+    if (spill_runs(ps->runs) == 0 || is_gone(ps, cp))
+	return 0;
+    made = cell_skey(cp, &key);
+    found = spill_find(ps->runs, &key, vp);
+    if (made != NULL)
+	free_STRING(made);
+    return found;
+}
+
+/*
+ * find_slot() for an array which spills.  An element found only in the
+ * runs is put in the table, unless create_flag is NO_CREATE or CREATE_COPY,
+ * for which a copy is returned in *epp.
+ */
+static SLOT *
+spill_slot(
+	      ARRAY A,
+	      CELL *cp,
+	      int create_flag,
+	      CELL **epp)
+{
+    SPILLING *ps = A->spill;
+    SLOT *sp;
+    int found = 0;
+
+    *epp = (CELL *) 0;
+    if (A->size != 0 && (sp = find_slot(A, cp, NO_CREATE, epp)) != NULL)
+	return sp;
+    cell_destroy(&spilled_value);
+    spilled_value.type = C_NOINIT;
+    if (ps->ondisk != 0)
+	found = in_runs(ps, cp, &spilled_value);
+    if (found && (create_flag == NO_CREATE || create_flag == CREATE_COPY)) {
+	*epp = &spilled_value;
+	return (SLOT *) 0;
+    }
+    if (!create_flag)
+	return (SLOT *) 0;
+    if (A->size + (ps->gone ? ps->gone->size : 0) >= ps->limit)
+	spill_out(A);
+    if (found && spilled_value.type != C_DOUBLE)
+	create_flag = CREATE;
+    sp = find_slot(A, cp, create_flag, epp);
+    if (found) {
+	if (slot_is_node(sp))
+	    sp->node->cell = spilled_value;
+	else
+	    ((CNODE *) sp->node)->dval = spilled_value.dval;
+	spilled_value.type = C_NOINIT;
+	ps->ondisk--;
+    } else if (is_gone(ps, cp)) {
+	array_delete(ps->gone, cp);
+    }
+    return sp;
+}
+
+/* array_delete() for an array which spills */
+static void
+spill_delete(
+		ARRAY A,
+		CELL *cp)
+{
+    SPILLING *ps = A->spill;
+    SLOT *sp;
+    CELL *ep;
+    int resident = 0;
+
+    if (A->size != 0 && (sp = find_slot(A, cp, NO_CREATE, &ep)) != NULL) {
+	delete_node(A, sp);
+	resident = 1;
+    }
+    if ((resident || ps->ondisk != 0) && in_runs(ps, cp, (CELL *) 0)) {
+	/* the copy in the runs must be hidden */
+	if (!resident)
+	    ps->ondisk--;
+	if (ps->gone == NULL)
+	    ps->gone = new_ARRAY();
+	(void) find_slot(ps->gone, cp, CREATE, &ep);
+	if (A->size + ps->gone->size > ps->limit)
+	    spill_out(A);
+    }
+}
+
+static int
+compare_slots(
+		 const void *a,
+		 const void *b)
+{
+    const SLOT *sa = (const SLOT *) a;
+    const SLOT *sb = (const SLOT *) b;
+    SPILL_KEY ka, kb;
+
+    if (sa->hval != sb->hval)
+	return (sa->hval < sb->hval) ? -1 : 1;
+    slot_skey(sa, &ka);
+    slot_skey(sb, &kb);
+    return spill_compare(&ka, &kb);
+}
+
+/* the slots of a nonempty table, in the order of a run */
+static SLOT *
+sorted_slots(ARRAY A)
+{
+    SLOT *table = (SLOT *) A->ptr;
+    SLOT *v = (SLOT *) zmalloc(SizeTimes(A->size, sizeof(SLOT)));
+    size_t n = 0;
+    unsigned i;
+
+    for (i = 0; i <= A->hmask; i++) {
+	if (table[i].node)
+	    v[n++] = table[i];
+    }
+    qsort(v, n, sizeof(SLOT), compare_slots);
+    return v;
+}
+
+static PTR *pins;		/* cells referenced from the eval stacks */
+static size_t pin_count;
+static size_t pin_limit;
+
+static void
+add_pins(
+	    CELL *cells,
+	    size_t cnt)
+{
+    size_t i;
+
+    for (i = 0; i < cnt; i++) {
+	if (cells[i].ptr == NULL)
+	    continue;
+	if (pin_count == pin_limit) {
+	    size_t limit = pin_limit ? 2 * pin_limit : EVAL_STACK_SIZE;
+	    if (pin_limit)
+		pins = (PTR *) zrealloc(pins, pin_limit * sizeof(PTR),
+					limit * sizeof(PTR));
+	    else
+		pins = (PTR *) zmalloc(limit * sizeof(PTR));
+	    pin_limit = limit;
+	}
+	pins[pin_count++] = cells[i].ptr;
+    }
+}
+
+static int
+compare_pins(
+		const void *a,
+		const void *b)
+{
+    const char *pa = *(const char *const *) a;
+    const char *pb = *(const char *const *) b;
+
+    return (pa > pb) - (pa < pb);
+}
+
+/* does a cell on an eval stack, maybe a stale one, point at the node? */
+static int
+is_pinned(ANODE *p)
+{
+    PTR key = (PTR) & p->cell;
+
+    return (pin_count != 0
+	    && bsearch(&key, pins, pin_count, sizeof(PTR), compare_pins) != NULL);
+}
+
+/* the table has been written out, so empty it but for pinned nodes */
+static void
+drop_table(ARRAY A)
+{
+    SPILLING *ps = A->spill;
+    SLOT *old = (SLOT *) A->ptr;
+    SLOT *table;
+    size_t sz = table_size(A->hmask);
+    size_t kept = 0;
+    unsigned i;
+
+    pin_count = 0;
+    if (A->arena->full_nodes != 0) {
+	eval_stacks(add_pins);
+	qsort(pins, pin_count, sizeof(PTR), compare_pins);
+    }
+    if (pin_count == 0) {
+	ps->ondisk += A->size;
+	clear_table(A);
+	return;
+    }
+    array_changes(A);
+    table = (SLOT *) memset(zmalloc(sz), 0, sz);
+    for (i = 0; i <= A->hmask; i++) {
+	if (old[i].node == NULL) {
+	    continue;
+	} else if (slot_is_node(old + i) && is_pinned(old[i].node)) {
+	    insert_slot(table, A->hmask, old[i]);
+	    kept++;
+	} else {
+	    free_node(A, old + i);
+	}
+    }
+    zfree(old, sz);
+    A->ptr = (PTR) table;
+    ps->ondisk += A->size - kept;
+    A->size = kept;
+    if (kept == 0)
+	clear_table(A);
+}
+
+/* write the table and the deleted keys to a new run */
+static void
+spill_out(ARRAY A)
+{
+    SPILLING *ps = A->spill;
+    ARRAY gone = ps->gone;
+    size_t n = A->size;
+    size_t m;
+    SLOT *live = (SLOT *) 0;
+    SLOT *dead = (SLOT *) 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    if (gone != NULL && gone->type == AY_SPLIT)
+	convert_split_array_to_table(gone);
+    m = gone ? gone->size : 0;
+    if (n + m == 0)
+	return;
+    if (n)
+	live = sorted_slots(A);
+    if (m)
+	dead = sorted_slots(gone);
+    spill_begin(ps->runs, n + m);
+    while (i < n || j < m) {
+	SPILL_KEY key, other;
+	if (i < n)
+	    slot_skey(live + i, &key);
+	if (j < m)
+	    slot_skey(dead + j, &other);
+	if (j == m || (i < n && spill_compare(&key, &other) < 0)) {
+	    CELL c;
+	    if (slot_is_node(live + i)) {
+		spill_put(ps->runs, &key, &live[i].node->cell);
+	    } else {
+		c.type = C_DOUBLE;
+		c.dval = ((CNODE *) live[i].node)->dval;
+		spill_put(ps->runs, &key, &c);
+	    }
+	    i++;
+	} else {
+	    spill_put(ps->runs, &other, (CELL *) 0);
+	    j++;
+	}
+    }
+    spill_end(ps->runs);
+    if (n) {
+	zfree(live, n * sizeof(SLOT));
+	drop_table(A);
+    }
+    if (m) {
+	zfree(dead, m * sizeof(SLOT));
+	array_clear(gone);
+    }
+}
+
+/* read the runs back into the table, as sorting the array needs */
+static void
+spill_gather(ARRAY A)
+{
+    SPILLING *ps = A->spill;
+    SPILL_STREAM st;
+    SPILL_KEY key;
+    CELL c;
+    CELL value;
+
+    if (spill_runs(ps->runs) == 0)
+	return;
+    spill_out(A);
+    st = spill_open(ps->runs);
+    while (spill_next(st, &key, &value)) {
+	CELL *ep;
+	skey_cell(&key, &c);
+	if (A->size == 0 || find_slot(A, &c, NO_CREATE, &ep) == NULL)
+	    find_slot(A, &c, CREATE, &ep)->node->cell = value;
+	else
+	    cell_destroy(&value);
+	cell_destroy(&c);
+    }
+    spill_close(st);
+    drop_runs(ps);
+}
+
+/* the array is empty, or its runs have been read back */
+static void
+drop_runs(SPILLING * ps)
+{
+    if (ps->gone != NULL)
+	array_clear(ps->gone);
+    if (spill_runs(ps->runs) != 0) {
+	spill_free(ps->runs);
+	ps->runs = spill_new();
+    }
+    ps->ondisk = 0;
+}
+
+/* the table of an array which spills is never a split array */
+static void
+no_split(ARRAY A)
+{
+    if (A->type == AY_SPLIT) {
+	if (A->size != 0)
+	    convert_split_array_to_table(A);
+	else
+	    clear_table(A);
+    }
+}
+
+/*
+ * -W spill: keep at most limit elements of A in memory, writing the rest
+ * to temporary files.  A limit of zero makes A an ordinary empty array.
+ */
+void
+array_spill(
+	       ARRAY A,
+	       size_t limit)
+{
+    SPILLING *ps = A->spill;
+
+    if (limit == 0) {
+	if (ps != NULL) {
+	    array_clear(A);
+	    if (ps->gone != NULL)
+		ZFREE(ps->gone);
+	    spill_free(ps->runs);
+	    ZFREE(ps);
+	    A->spill = (SPILLING *) 0;
+	    cell_destroy(&spilled_value);
+	    spilled_value.type = C_NOINIT;
+	    if (pin_limit) {
+		zfree(pins, pin_limit * sizeof(PTR));
+		pins = (PTR *) 0;
+		pin_count = pin_limit = 0;
+	    }
+	}
+	return;
+    }
+    if (ps == NULL) {
+	ps = ZMALLOC(SPILLING);
+	ps->ondisk = 0;
+	ps->gone = (ARRAY) 0;
+	ps->runs = spill_new();
+	A->spill = ps;
+	no_split(A);
+    }
+    ps->limit = limit;
+}
+
+#define alloc_size(n) (((size_t) (n) + 7) & ~(size_t) 7)	/* as zmalloc() rounds */
+
+/* the bytes of the string held by a cell */
+static size_t
+string_bytes(const CELL *cp)
+{
+    if (cp->type >= C_STRING && cp->type <= C_MBSTRN)
+	return alloc_size(string(cp)->len + STRING_OH);
+    return 0;
+}
+
+/* for -W stats, the memory used by a global array */
+static void
+report_array(SYMTAB * stp)
+{
+    ARRAY A;
+    size_t table = 0, nodes = 0, keys = 0, values = 0, counts = 0;
+    size_t i;
+
+    if (stp->type != ST_ARRAY || array_length(A = stp->stval.array) == 0)
+	return;
+    if (A->type == AY_SPLIT) {
+	table = SPLIT_BLOCK(A->limit) + A->nbanks * sizeof(ANODE *);
+	for (i = 0; i < A->nbanks; i++) {
+	    if (A->banks[i])
+		table += SPLIT_BLOCK(ABANK_SZ);
+	}
+	for (i = 0; i < A->size; i++)
+	    values += string_bytes(split_cell(A, i));
+    } else if (A->type != AY_NULL) {
+	SLOT *t = (SLOT *) A->ptr;
+	NODE_BLOCK *bp;
+	table = table_size(A->hmask);
+	nodes = sizeof(ARENA);
+	for (bp = A->arena->blocks; bp != NULL; bp = bp->link)
+	    nodes += bp->size;
+	for (i = 0; i <= A->hmask; i++) {
+	    if (t[i].node == NULL) {
+		continue;
+	    } else if (slot_is_node(t + i)) {
+		ANODE *p = t[i].node;
+		if (p->sval)
+		    keys += alloc_size(p->sval->len + STRING_OH);
+		values += string_bytes(&p->cell);
+	    } else {
+		counts++;
+	    }
+	}
+    }
+    fprintf(stderr,
+	    "%s: array %s: %lu elements (%lu counts), %lu bytes:"
+	    " table %lu, nodes %lu, keys %lu, values %lu\n",
+	    progname, stp->name,
+	    (unsigned long) array_length(A),
+	    (unsigned long) counts,
+	    (unsigned long) (table + nodes + keys + values),
+	    (unsigned long) table,
+	    (unsigned long) nodes,
+	    (unsigned long) keys,
+	    (unsigned long) values);
+    if (A->spill && spill_runs(A->spill->runs) != 0) {
+	SPILLING *ps = A->spill;
+	size_t records, bytes, memory;
+
+	spill_stats(ps->runs, &records, &bytes, &memory);
+	fprintf(stderr,
+		"%s: array %s: %lu elements only on disk, %lu runs:"
+		" %lu records, %lu bytes, index %lu bytes\n",
+		progname, stp->name,
+		(unsigned long) ps->ondisk,
+		(unsigned long) spill_runs(ps->runs),
+		(unsigned long) records,
+		(unsigned long) bytes,
+		(unsigned long) memory);
+    }
+}
+
+/* -W stats */
+void
+array_stats(void)
+{
+    hash_walk(report_array);
 }
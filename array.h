@@ -34,10 +34,30 @@ typedef struct _array
     size_t limit;		/* Meaning depends on type */
     unsigned hmask;		/* bitwise and with hash value to get table index */
     short type;			/* values in AY_NULL .. AY_SPLIT */
+    struct _array_loop *loops;	/* for-in loops walking the table */
+    struct anode **banks;	/* AY_SPLIT elements past limit */
+    size_t nbanks;		/* room in banks */
+    struct _arena *arena;	/* where the nodes of a table are cut */
+    struct _spilling *spill;	/* for an array named by -W spill */
 }
 #endif
  *ARRAY;
 
+/* the state of a for-in loop */
+typedef struct _array_loop
+#ifdef Visible_ARRAY
+{
+    struct _array_loop *link;	/* another loop walking the same array */
+    ARRAY A;			/* the array walked, or null once copied */
+    size_t index;		/* next slot or split element to visit */
+    CELL *base;			/* the keys left to visit once copied */
+    CELL *ptr;
+    CELL *limit;
+    struct _spill_stream *stream;	/* the merged runs of a spilled array */
+}
+#endif
+ *ARRAY_LOOP;
+
 #define AY_NULL         0
 #define AY_INT          1
 #define AY_STR          2
@@ -47,10 +67,28 @@ typedef struct _array
 #define CREATE     1
 #define new_ARRAY()  ((ARRAY)memset(ZMALLOC(struct _array),0,sizeof(struct _array)))
 CELL *array_find(ARRAY, CELL *, int);
+void array_get(ARRAY, CELL *);
+double array_incdec(ARRAY, CELL *, double);
 void array_delete(ARRAY, CELL *);
 void array_load(ARRAY, size_t);
 void array_clear(ARRAY);
-STRING **array_loop_vector(ARRAY, size_t *);
+size_t array_length(ARRAY);
+void array_spill(ARRAY, size_t);
+/* orders for asort(), asorti() and -W order */
+#define SORT_BY_INDEX   1
+#define SORT_BY_VALUE   2
+#define SORT_AS_NUMBER  4	/* else as strings */
+#define SORT_AS_TYPE    8	/* numbers, then strings */
+#define SORT_DESCENDING 16
+
+extern int array_loop_order;
+
+int array_sort_order(const char *, size_t);
+size_t array_sort(ARRAY, ARRAY, int, int);
+ARRAY_LOOP array_loop_open(ARRAY);
+int array_loop_next(ARRAY_LOOP, CELL *);
+void array_loop_close(ARRAY_LOOP);
 CELL *array_cat(CELL *, int);
+void array_stats(void);
 
 #endif /* ARRAY_H */
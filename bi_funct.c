@@ -152,11 +152,55 @@ bi_alength(CELL *sp)
     TRACE_FUNC2("bi_alength", sp, 1);
 
     sp->type = C_DOUBLE;
-    sp->dval = (double) ((ARRAY) sp->ptr)->size;
+    sp->dval = (double) array_length((ARRAY) sp->ptr);
 
     return_CELL("bi_alength", sp);
 }
 
+/*
+ * asort(A [,B [,how]]) and asorti(A [,B [,how]]) put the values or the
+ * indices of A in order into B[1..n], or into A if there is no B, and
+ * return n.
+ */
+static CELL *
+sort_array(CELL *sp, int indices)
+{
+    int n_args;
+    ARRAY src;
+    ARRAY dest;
+    int order = (indices
+		 ? SORT_BY_INDEX
+		 : (SORT_BY_VALUE | SORT_AS_TYPE));
+
+    n_args = sp->type;
+    sp -= n_args;
+    src = (ARRAY) sp->ptr;
+    dest = (n_args > 1) ? (ARRAY) sp[1].ptr : src;
+    if (n_args > 2) {
+	if (sp[2].type < C_STRING)
+	    cast1_to_s(sp + 2);
+	order = array_sort_order(string(sp + 2)->str, string(sp + 2)->len);
+	if (order < 0)
+	    rt_error("unknown sort order \"%s\"", string(sp + 2)->str);
+	free_STRING(string(sp + 2));
+    }
+    sp->type = C_DOUBLE;
+    sp->dval = (double) array_sort(src, dest, order, indices);
+    return sp;
+}
+
+CELL *
+bi_asort(CELL *sp)
+{
+    return sort_array(sp, 0);
+}
+
+CELL *
+bi_asorti(CELL *sp)
+{
+    return sort_array(sp, 1);
+}
+
 char *
 str_str(char *target, size_t target_len, const char *key, size_t key_len)
 {
@@ -743,7 +787,7 @@ static CELL cseed;		/* argument of last call to srand() */
 #endif /* M == MAX__LONG */
 #endif /* defined(mawk_srand) || defined(mawk_rand) */
 
-static double
+double
 initial_seed(void)
 {
     double result;
@@ -1132,21 +1176,75 @@ bi_sub(CELL *sp)
 
 static unsigned repl_cnt;	/* number of global replacements */
 
+/*
+ * gsub3() builds its result in a growable buffer, making a STRING only once
+ * at the end.
+ */
+typedef struct {
+    char *base;
+    size_t used;
+    size_t limit;
+} GSUB_BUFF;
+
+static void
+gsub_append(GSUB_BUFF * gb, const char *data, size_t len)
+{
+    if (len != 0) {
+	size_t need = SizePlus(gb->used, len);
+
+	if (need > gb->limit) {
+	    size_t limit = SizeTimes(need, 2);
+
+	    gb->base = (char *) zrealloc(gb->base, gb->limit, limit);
+	    gb->limit = limit;
+	}
+	memcpy(gb->base + gb->used, data, len);
+	gb->used = need;
+    }
+}
+
+/*
+ * If the replacement is a vector (i.e., contains "&"), update the cached
+ * replacement text in xrepl if the matched text differs from the last match.
+ */
+static void
+gsub_matched(CELL *xrepl, CELL *repl, const char *where, size_t howmuch)
+{
+    if (repl->type == C_REPLV) {
+	if (xrepl->ptr == NULL ||
+	    string(xrepl)->len != howmuch ||
+	    (howmuch != 0 &&
+	     memcmp(string(xrepl)->str, where, howmuch))) {
+	    STRING *sval;
+
+	    if (xrepl->ptr != NULL)
+		repl_destroy(xrepl);
+	    sval = new_STRING1(where, howmuch);
+	    cellcpy(xrepl, repl);
+	    replv_to_repl(xrepl, sval);
+	    free_STRING(sval);
+	}
+    }
+}
+
+/*
+ * Replace all matches of re in target, scanning left-to-right once.  Each
+ * match is the leftmost-longest match at or after the end of the previous
+ * one.  An empty match adjacent to the previous (nonempty) match is ignored,
+ * and the character following an empty match is copied to the output.
+ */
 static STRING *
 gsub3(PTR re, CELL *repl, CELL *target)
 {
-    int j;
     CELL xrepl;
     STRING *input = string(target);
     STRING *output;
-    STRING *buffer;
-    STRING *sval;
-    size_t have;
-    size_t used = 0;
-    size_t guess = input->len;
-    size_t limit = guess;
-
-    int skip0 = -1;
+    GSUB_BUFF gb;
+    char *s = input->str;
+    char *end = s + input->len;
+    char *last = NULL;		/* end of the previous nonempty match */
+    char *where;
+    char *key;
     size_t howmuch;
 
     TRACE(("called gsub3\n"));
@@ -1161,115 +1259,86 @@ gsub3(PTR re, CELL *repl, CELL *target)
     }
 
     repl_cnt = 0;
-    output = new_STRING0(limit);
-
-    for (j = 0; j <= (int) input->len; ++j) {
-	char *where = REmatch(input->str + j,
-			      input->len - (size_t) j,
-			      cast_to_re(re),
-			      &howmuch,
-			      (j != 0));
+    gb.used = 0;
+    gb.limit = SizePlus(input->len, 1);
+    gb.base = (char *) zmalloc(gb.limit);
+
+    if ((key = is_string_match(re, &howmuch)) != NULL) {
 	/*
-	 * REmatch returns a non-null pointer if it found a match.  But
-	 * that can be an empty string, e.g., for "*" or "?".  The length
-	 * is in 'howmuch'.
+	 * A literal pattern matches only its own text, never an empty string.
 	 */
-	if (where != NULL) {
-	    have = (size_t) (where - (input->str + j));
-	    if (have) {
-		skip0 = -1;
-		TRACE(("..before match:%d:", (int) have));
-		TRACE_STRING2(input->str + j, have);
+	TRACE(("..literal pattern:"));
+	TRACE_STRING2(key, howmuch);
+	TRACE(("\n"));
+	while ((where = str_str(s, (size_t) (end - s), key, howmuch)) != NULL) {
+	    gsub_append(&gb, s, (size_t) (where - s));
+	    gsub_matched(&xrepl, repl, where, howmuch);
+	    gsub_append(&gb, string(&xrepl)->str, string(&xrepl)->len);
+	    ++repl_cnt;
+	    s = where + howmuch;
+	}
+	gsub_append(&gb, s, (size_t) (end - s));
+    } else {
+	while (s <= end) {
+	    /* an anchored pattern cannot match after the beginning */
+	    if (s != input->str && isAnchored(re)) {
+		gsub_append(&gb, s, (size_t) (end - s));
+		break;
+	    }
+	    where = REmatch(s,
+			    (size_t) (end - s),
+			    cast_to_re(re),
+			    &howmuch,
+			    (s != input->str));
+	    /*
+	     * REmatch returns a non-null pointer if it found a match.  But
+	     * that can be an empty string, e.g., for "*" or "?".  The length
+	     * is in 'howmuch'.
+	     */
+	    if (where == NULL) {
+		TRACE(("..after match:%d:", (int) (end - s)));
+		TRACE_STRING2(s, (size_t) (end - s));
 		TRACE(("\n"));
-		memcpy(output->str + used, input->str + j, have);
-		used += have;
+		gsub_append(&gb, s, (size_t) (end - s));
+		break;
 	    }
 
-	    TRACE(("REmatch %d vs %d len=%d:", (int) j, skip0, (int) howmuch));
+	    TRACE(("REmatch %d len=%d:", (int) (where - input->str), (int) howmuch));
 	    TRACE_STRING2(where, howmuch);
 	    TRACE(("\n"));
 
-	    if (repl->type == C_REPLV) {
-		if (xrepl.ptr == NULL ||
-		    string(&xrepl)->len != howmuch ||
-		    (howmuch != 0 &&
-		     memcmp(string(&xrepl)->str, where, howmuch))) {
-		    if (xrepl.ptr != NULL)
-			repl_destroy(&xrepl);
-		    sval = new_STRING1(where, howmuch);
-		    cellcpy(&xrepl, repl);
-		    replv_to_repl(&xrepl, sval);
-		    free_STRING(sval);
-		}
-	    }
-
-	    have = string(&xrepl)->len;
-	    TRACE(("..replace:"));
-	    TRACE_STRING2(string(&xrepl)->str, have);
-	    TRACE(("\n"));
+	    gsub_append(&gb, s, (size_t) (where - s));
 
-	    if (howmuch || (j != skip0)) {
+	    if (howmuch || (where != last)) {
+		gsub_matched(&xrepl, repl, where, howmuch);
+		gsub_append(&gb, string(&xrepl)->str, string(&xrepl)->len);
 		++repl_cnt;
-
-		/*
-		 * If this new chunk is longer than its replacement, add that
-		 * to the estimate of the length.  Then, if the estimate goes
-		 * past the allocated length, reallocate and copy the existing
-		 * data.
-		 */
-		if (have > howmuch) {	/* growing */
-		    guess += (have - howmuch);
-		    if (guess >= limit) {
-			buffer = output;
-			limit = (++guess) * 2;	/* FIXME - too coarse? */
-			output = new_STRING0(limit);
-			memcpy(output->str, buffer->str, used);
-			free_STRING(buffer);
-		    }
-		} else if (howmuch > have) {	/* shrinking */
-		    guess -= (howmuch - have);
-		}
-
-		/*
-		 * Finally, copy the new chunk.
-		 */
-		memcpy(output->str + used, string(&xrepl)->str, have);
-		used += have;
 	    }
 
 	    if (howmuch) {
-		j = (int) ((size_t) (where - input->str) + howmuch) - 1;
+		s = last = where + howmuch;
 	    } else {
-		j = (int) (where - input->str);
-		if (j < (int) input->len) {
-		    TRACE(("..emptied:"));
-		    TRACE_STRING2(input->str + j, 1);
-		    TRACE(("\n"));
-		    output->str[used++] = input->str[j];
+		if (where < end) {
+		    gsub_append(&gb, where, (size_t) 1);
 		}
+		s = where + 1;
+		last = NULL;
 	    }
-	    skip0 = (howmuch != 0) ? (j + 1) : -1;
-	} else {
-	    have = (input->len - (size_t) j);
-	    TRACE(("..after match:%d:", (int) have));
-	    TRACE_STRING2(input->str + j, have);
-	    TRACE(("\n"));
-	    memcpy(output->str + used, input->str + j, have);
-	    used += have;
-	    break;
 	}
     }
 
     TRACE(("..input %d ->output %d\n",
 	   (int) input->len,
-	   (int) output->len));
+	   (int) gb.used));
 
     repl_destroy(&xrepl);
-    if (output->len > used) {
-	buffer = output;
-	output = new_STRING1(output->str, used);
-	free_STRING(buffer);
+    if (repl_cnt) {
+	output = new_STRING1(gb.base, gb.used);
+    } else {
+	output = input;
+	output->ref_cnt++;
     }
+    zfree(gb.base, gb.limit);
     TRACE(("..done gsub3\n"));
     return output;
 }
@@ -22,12 +22,15 @@ the GNU General Public License, version 2, 1991.
 extern const BI_REC bi_funct[];
 
 void bi_init(void);
+double initial_seed(void);
 
 /* builtin string functions */
 CELL *bi_print(CELL *);
 CELL *bi_printf(CELL *);
 CELL *bi_length(CELL *);
 CELL *bi_alength(CELL *);	/* length/size of an array */
+CELL *bi_asort(CELL *);
+CELL *bi_asorti(CELL *);
 CELL *bi_index(CELL *);
 CELL *bi_substr(CELL *);
 CELL *bi_sprintf(CELL *);
@@ -24,7 +24,7 @@ the GNU General Public License, version 2, 1991.
 #include <scan.h>
 
 const int mpow2[NUM_CELL_TYPES] =
-{1, 2, 4, 8, 16, 32, 64, 128, 256, 512};
+{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024};
 
 #define isXDIGIT(c) \
 	(scan_code[(c)] == SC_DIGIT \
@@ -74,9 +74,8 @@ string_to_double(CELL *cp)
 #else
     cp->dval = strtod(q, (char **) 0);
 #endif
-    free_STRING(string(cp));
-
   done:
+    free_STRING(string(cp));
     cp->type = C_DOUBLE;
 }
 
@@ -170,7 +169,7 @@ cast2_to_d(CELL *cp)
 	} else { \
 	    Long lval = d_to_L(source->dval); \
 	    if (lval == source->dval) { \
-		sprintf(target, LONG_FMT, lval); \
+		L_to_str(lval, target); \
 	    } else { \
 		sprintf(target, string(CONVFMT)->str, source->dval); \
 	    } \
@@ -476,6 +475,29 @@ d_to_UL(double d)
     return result;
 }
 
+/* store ival in decimal at target, as sprintf(LONG_FMT) would, returning
+   the length */
+size_t
+L_to_str(Long ival, char *target)
+{
+    char digits[sizeof(Long) * 3 + 2];
+    char *p = digits + sizeof(digits);
+    ULong uval = (ival < 0) ? (ULong) (-ival) : (ULong) ival;
+    size_t len;
+
+    do {
+	*--p = (char) ('0' + (int) (uval % 10));
+	uval /= 10;
+    } while (uval != 0);
+    if (ival < 0)
+	*--p = '-';
+
+    len = (size_t) (digits + sizeof(digits) - p);
+    memcpy(target, p, len);
+    target[len] = '\0';
+    return len;
+}
+
 #ifdef NO_LEAKS
 typedef struct _all_cells {
     struct _all_cells *next;
@@ -14,20 +14,21 @@ the GNU General Public License, version 2, 1991.
  * $MawkId: code.c,v 1.50 2024/12/14 21:21:20 tom Exp $
  */
 
+#define Visible_BI_REC
 #define Visible_CELL
 #define Visible_CODEBLOCK
 #define Visible_FBLOCK
 #define Visible_STRING
+#define Visible_SYMTAB
 
 #include <mawk.h>
 #include <code.h>
 #include <init.h>
 #include <jmp.h>
 #include <field.h>
-
-#ifdef NO_LEAKS
+#include <bi_vars.h>
+#include <bi_funct.h>
 #include <scan.h>
-#endif
 
 static CODEBLOCK *new_code(void);
 
@@ -248,6 +249,1098 @@ be_setup(int scope)
     }
 }
 
+/* the number of operands following an opcode */
+static int
+operand_count(int op)
+{
+    switch ((MAWK_OPCODES) op) {
+    case F_PUSHI:
+    case _CALLX:
+    case _CALL:
+	return 2;
+    case _ICALL:
+	return 3;
+    case _RANGE:
+	return 4;
+    case L_PUSHA:
+    case L_PUSHI:
+    case LAE_PUSHI:
+    case LAE_PUSHA:
+    case LA_PUSHA:
+    case F_PUSHA:
+    case AE_PUSHA:
+    case AE_PUSHI:
+    case A_PUSHA:
+    case _PUSHI:
+    case _PUSHA:
+    case _MATCH0:
+    case _MATCH1:
+    case _PUSHS:
+    case _PUSHD:
+    case _PUSHC:
+    case _PUSHINT:
+    case _BUILTIN:
+    case _PRINT:
+    case _JMP:
+    case _JNZ:
+    case _JZ:
+    case _LJZ:
+    case _LJNZ:
+    case SET_ALOOP:
+    case ALOOP:
+    case A_CAT:
+    case A_LENGTH:
+    case _LENGTH:
+    case _JCMP_D:
+    case _JCMP_I:
+    case _ARITH_D:
+    case _ARITH_I:
+    case _INCDEC:
+    case AE_INCDEC:
+    case AE_INCDEC_V:
+    case _IRET:
+	return 1;
+    default:
+	return 0;
+    }
+}
+
+/* release the constants owned by code which the parser throws away */
+void
+code_discard(INST * p, INST * limit)
+{
+    for (; p < limit; p += 1 + operand_count(p->op)) {
+	switch (p->op) {
+	case _PUSHS:
+	    free_STRING((STRING *) p[1].ptr);
+	    break;
+	case _PUSHD:
+	    if (p[1].ptr != (PTR) & double_zero && p[1].ptr != (PTR) & double_one)
+		ZFREE((double *) p[1].ptr);
+	    break;
+	}
+    }
+}
+
+static void (*block_action) (INST **, size_t *);
+
+static void
+funct_block_action(SYMTAB * stp)
+{
+    if (stp->type == ST_FUNCT && stp->stval.fbp->code != NULL)
+	block_action(&stp->stval.fbp->code, &stp->stval.fbp->size);
+}
+
+/* apply an action to each code block, the user functions first */
+static void
+each_block(void (*action) (INST **, size_t *))
+{
+    block_action = action;
+    hash_walk(funct_block_action);
+    if (begin_start != NULL)
+	action(&begin_start, &begin_size);
+    if (main_start != NULL)
+	action(&main_start, &main_size);
+    if (end_start != NULL)
+	action(&end_start, &end_size);
+}
+
+#define isRelOp(op) ((op) >= _EQ && (op) <= _GTE)
+#define isArithOp(op) ((op) >= _ADD && (op) <= _DIV)
+#define isIncDec(op) ((op) >= _POST_INC && (op) <= _PRE_DEC)
+
+/*
+ * Peephole pass over finished code, replacing the first opcode of some
+ * common sequences with a superinstruction which executes the whole
+ * sequence with one dispatch.  Only that first slot is changed:  the
+ * handler reads the other opcodes of the sequence as operands, and a jump
+ * into the middle of the sequence still finds the original instructions.
+ * Jump offsets and the code size are unchanged.
+ */
+static void
+fuse_block(INST ** basep, size_t *sizep)
+{
+    INST *p = *basep;
+
+    (void) sizep;
+    while (p->op != _HALT) {
+	switch ((MAWK_OPCODES) p->op) {
+	case _PUSHD:
+	case _PUSHI:
+	    /* $3 > 100, i < n */
+	    if (isRelOp(p[2].op) && (p[3].op == _JZ || p[3].op == _JNZ)) {
+		p->op = (p->op == _PUSHD) ? _JCMP_D : _JCMP_I;
+	    }
+	    /* x * 2, y + z */
+	    else if (isArithOp(p[2].op)) {
+		p->op = (p->op == _PUSHD) ? _ARITH_D : _ARITH_I;
+	    }
+	    p += 2;
+	    break;
+
+	case _PUSHA:
+	case AE_PUSHA:
+	    /* n++, a[$1]++ */
+	    if (isIncDec(p[2].op) && p[3].op == _POP) {
+		p->op = (p->op == _PUSHA) ? _INCDEC : AE_INCDEC;
+	    }
+	    /* !seen[$0]++ */
+	    else if (p->op == AE_PUSHA && isIncDec(p[2].op)) {
+		p->op = AE_INCDEC_V;
+	    }
+	    p += 2;
+	    break;
+
+	case _ASSIGN:
+	    if (p[1].op == _POP)
+		p->op = _ASSIGN_POP;
+	    p++;
+	    break;
+
+	case _ADD_ASG:
+	    if (p[1].op == _POP)
+		p->op = _ADD_ASG_POP;
+	    p++;
+	    break;
+
+	default:
+	    p += 1 + operand_count(p->op);
+	    break;
+	}
+    }
+}
+
+/* called after code_hoist(), when all the code is final */
+void
+code_fuse(void)
+{
+    each_block(fuse_block);
+}
+
+/*
+ * Type specialization.  A global variable whose every assignment stores a
+ * number always holds a number (or is still uninitialized, which is zero).
+ * An arithmetic or relational operator whose operands are such variables
+ * or other numeric expressions is replaced by a D_ opcode, which skips the
+ * type tests and conversions of the generic opcode.
+ *
+ * The analysis follows the evaluation stack through straight-line code;
+ * at a jump target, or after an instruction it does not model, nothing is
+ * known about the stack.  Function locals are not specialized, since their
+ * values come from the caller.  A command-line assignment to a specialized
+ * variable can store a string at run-time:  code_unspecialize() then puts
+ * the generic opcodes back.
+ */
+
+#define isDoubleOp(op) ((op) >= D_ADD && (op) <= D_GTE)
+
+#define T_UNKNOWN   0		/* anything */
+#define T_NUMBER    1		/* a double */
+#define T_VALUE     2		/* the value of numvars[var] */
+#define T_ADDRESS   3		/* the address of numvars[var] */
+
+#define TSTACK_SIZE 32
+
+typedef struct {
+    int kind;
+    int var;
+} TVALUE;
+
+typedef struct {
+    CELL *cp;
+    int stores;			/* times its address is pushed */
+    int numbers;		/* times a number is stored through it */
+    int numeric;
+} NUMVAR;
+
+typedef struct {
+    int var;			/* var = from */
+    int from;
+} NUMDEP;
+
+static NUMVAR *numvars;
+static int numvar_count;
+static int numvar_limit;
+
+static NUMDEP *numdeps;
+static int numdep_count;
+static int numdep_limit;
+
+static INST **spec_blocks;
+static int spec_count;
+static int spec_limit;
+
+static int specialized;
+
+static TVALUE tstack[TSTACK_SIZE];
+static int tdepth;
+
+/* make room for 'step' more entries of size 'elem' in a table */
+static PTR
+grow_table(PTR table, size_t elem, int *limit, int step)
+{
+    size_t old = (size_t) *limit * elem;
+
+    *limit += step;
+    if (table == NULL)
+	return zmalloc((size_t) *limit * elem);
+    return zrealloc(table, old, (size_t) *limit * elem);
+}
+
+static int
+numvar_find(const CELL *cp)
+{
+    int n;
+
+    for (n = 0; n < numvar_count; ++n) {
+	if (numvars[n].cp == cp)
+	    return n;
+    }
+    return -1;
+}
+
+static void
+add_numvar(SYMTAB * stp)
+{
+    CELL *cp = stp->stval.cp;
+
+    if (stp->type != ST_VAR && stp->type != ST_NR)
+	return;
+    /* the other builtin variables are strings, or have side-effects */
+    if (cp >= bi_vars && cp < bi_vars + NUM_BI_VAR
+	&& cp != NR && cp != FNR && cp != RSTART && cp != RLENGTH)
+	return;
+    if (cp->type != C_NOINIT && cp->type != C_DOUBLE)
+	return;
+
+    if (numvar_count == numvar_limit)
+	numvars = (NUMVAR *) grow_table(numvars, sizeof(NUMVAR),
+					&numvar_limit, 32);
+    memset(numvars + numvar_count, 0, sizeof(NUMVAR));
+    numvars[numvar_count++].cp = cp;
+}
+
+static void
+add_numdep(int var, int from)
+{
+    if (numdep_count == numdep_limit)
+	numdeps = (NUMDEP *) grow_table(numdeps, sizeof(NUMDEP),
+					&numdep_limit, 32);
+    numdeps[numdep_count].var = var;
+    numdeps[numdep_count].from = from;
+    numdep_count++;
+}
+
+static void
+add_spec_block(INST * p)
+{
+    if (p == NULL)
+	return;
+    if (spec_count == spec_limit)
+	spec_blocks = (INST **) grow_table(spec_blocks, sizeof(INST *),
+					   &spec_limit, 16);
+    spec_blocks[spec_count++] = p;
+}
+
+static void
+add_funct_block(SYMTAB * stp)
+{
+    if (stp->type == ST_FUNCT)
+	add_spec_block(stp->stval.fbp->code);
+}
+
+static void
+tpush(int kind, int var)
+{
+    if (tdepth == TSTACK_SIZE) {
+	memmove(tstack, tstack + 1, sizeof(TVALUE) * (TSTACK_SIZE - 1));
+	tdepth--;
+    }
+    tstack[tdepth].kind = kind;
+    tstack[tdepth].var = var;
+    tdepth++;
+}
+
+static TVALUE
+tpop(void)
+{
+    TVALUE result;
+
+    if (tdepth == 0) {
+	result.kind = T_UNKNOWN;
+	result.var = -1;
+    } else {
+	result = tstack[--tdepth];
+    }
+    return result;
+}
+
+static int
+is_number(TVALUE v)
+{
+    return (v.kind == T_NUMBER
+	    || (v.kind == T_VALUE && numvars[v.var].numeric));
+}
+
+/* the opcode which a superinstruction replaced */
+static int
+fused_op(int op)
+{
+    switch (op) {
+    case _JCMP_D:
+    case _ARITH_D:
+	return _PUSHD;
+    case _JCMP_I:
+    case _ARITH_I:
+	return _PUSHI;
+    case _INCDEC:
+	return _PUSHA;
+    case AE_INCDEC:
+    case AE_INCDEC_V:
+	return AE_PUSHA;
+    case _ASSIGN_POP:
+	return _ASSIGN;
+    case _ADD_ASG_POP:
+	return _ADD_ASG;
+    default:
+	return op;
+    }
+}
+
+/* mark the instructions which are the target of a jump */
+static char *
+jump_targets(INST * base)
+{
+    INST *p = base;
+    char *targets;
+    size_t size;
+    int k;
+
+    while (p->op != _HALT)
+	p += 1 + operand_count(p->op);
+    size = (size_t) (p - base) + 1;
+    targets = (char *) zmalloc(size);
+    memset(targets, 0, size);
+
+#define MarkTarget(q) \
+	if ((q) >= base && (q) < base + size) targets[(q) - base] = 1
+
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	switch ((MAWK_OPCODES) p->op) {
+	case _JMP:
+	case _JZ:
+	case _JNZ:
+	case _LJZ:
+	case _LJNZ:
+	case SET_ALOOP:
+	case ALOOP:
+	case _IRET:
+	    MarkTarget(p + 1 + p[1].op);
+	    break;
+	case _RANGE:
+	    for (k = 2; k <= 4; ++k) {
+		MarkTarget(p + 1 + p[k].op);
+	    }
+	    break;
+	default:
+	    break;
+	}
+    }
+#undef MarkTarget
+    return targets;
+}
+
+/*
+ * Follow the evaluation stack through the code at base.  Without rewrite,
+ * count the stores to the candidate variables; with it, replace operators
+ * on numbers by their D_ opcodes.
+ */
+static void
+type_walk(INST * base, int rewrite)
+{
+    char *targets = jump_targets(base);
+    INST *p;
+    INST *fused = NULL;		/* operator read by a superinstruction */
+    TVALUE a, b;
+    int op;
+    int n;
+
+    tdepth = 0;
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	if (targets[p - base])
+	    tdepth = 0;
+
+	op = fused_op(p->op);
+	switch (op) {
+	case _PUSHD:
+	case _PUSHINT:
+	case _MATCH0:
+	    tpush(T_NUMBER, -1);
+	    break;
+
+	case _PUSHI:
+	    n = numvar_find((CELL *) p[1].ptr);
+	    tpush((n < 0) ? T_UNKNOWN : T_VALUE, n);
+	    break;
+
+	case _PUSHA:
+	    n = numvar_find((CELL *) p[1].ptr);
+	    if (n >= 0 && !rewrite)
+		numvars[n].stores++;
+	    tpush((n < 0) ? T_UNKNOWN : T_ADDRESS, n);
+	    break;
+
+	case _PUSHS:
+	case _PUSHC:
+	case L_PUSHI:
+	case NF_PUSHI:
+	case F_PUSHI:
+	    tpush(T_UNKNOWN, -1);
+	    break;
+
+	case _ADD:
+	case _SUB:
+	case _MUL:
+	case _DIV:
+	case _MOD:
+	case _POW:
+	case _EQ:
+	case _NEQ:
+	case _LT:
+	case _LTE:
+	case _GT:
+	case _GTE:
+	    b = tpop();
+	    a = tpop();
+	    if (rewrite && p != fused && is_number(a) && is_number(b)) {
+		p->op = (isRelOp(op)
+			 ? D_EQ + (op - _EQ)
+			 : D_ADD + (op - _ADD));
+	    }
+	    tpush(T_NUMBER, -1);
+	    break;
+
+	case _NOT:
+	case _TEST:
+	case _UMINUS:
+	case _UPLUS:
+	case _MATCH1:
+	    (void) tpop();
+	    tpush(T_NUMBER, -1);
+	    break;
+
+	case _MATCH2:
+	    (void) tpop();
+	    (void) tpop();
+	    tpush(T_NUMBER, -1);
+	    break;
+
+	case _CAT:
+	    (void) tpop();
+	    (void) tpop();
+	    tpush(T_UNKNOWN, -1);
+	    break;
+
+	case _POP:
+	case _JZ:
+	case _JNZ:
+	    (void) tpop();
+	    break;
+
+	case _ASSIGN:
+	    b = tpop();
+	    a = tpop();
+	    if (a.kind == T_ADDRESS && !rewrite) {
+		if (b.kind == T_NUMBER) {
+		    numvars[a.var].numbers++;
+		} else if (b.kind == T_VALUE) {
+		    numvars[a.var].numbers++;
+		    add_numdep(a.var, b.var);
+		}
+	    }
+	    tpush(b.kind, b.var);
+	    break;
+
+	case _ADD_ASG:
+	case _SUB_ASG:
+	case _MUL_ASG:
+	case _DIV_ASG:
+	case _MOD_ASG:
+	case _POW_ASG:
+	    (void) tpop();
+	    /* FALLTHRU */
+	case _POST_INC:
+	case _POST_DEC:
+	case _PRE_INC:
+	case _PRE_DEC:
+	    a = tpop();
+	    if (a.kind == T_ADDRESS && !rewrite)
+		numvars[a.var].numbers++;
+	    tpush(T_NUMBER, -1);
+	    break;
+
+	default:
+	    tdepth = 0;
+	    break;
+	}
+
+	/* the _ARITH_D and _ARITH_I handlers switch on the generic op */
+	if (p->op == _ARITH_D || p->op == _ARITH_I)
+	    fused = p + 2;
+    }
+    zfree(targets, (size_t) (p - base) + 1);
+}
+
+/* called after resolve_fcalls(), when all the code is final */
+void
+code_specialize(void)
+{
+    int changed;
+    int n;
+
+    hash_walk(add_numvar);
+    if (numvar_count == 0)
+	return;
+
+    add_spec_block(begin_start);
+    add_spec_block(main_start);
+    add_spec_block(end_start);
+    hash_walk(add_funct_block);
+
+    for (n = 0; n < spec_count; ++n)
+	type_walk(spec_blocks[n], 0);
+
+    for (n = 0; n < numvar_count; ++n)
+	numvars[n].numeric = (numvars[n].stores == numvars[n].numbers);
+
+    /* x = y stores a number only if y holds numbers */
+    do {
+	changed = 0;
+	for (n = 0; n < numdep_count; ++n) {
+	    if (numvars[numdeps[n].var].numeric
+		&& !numvars[numdeps[n].from].numeric) {
+		numvars[numdeps[n].var].numeric = 0;
+		changed = 1;
+	    }
+	}
+    } while (changed);
+
+    for (n = 0; n < numvar_count; ++n) {
+	if (numvars[n].numeric) {
+	    /* the D_ opcodes use dval without looking at the type */
+	    if (numvars[n].cp->type == C_NOINIT)
+		numvars[n].cp->dval = 0.0;
+	    specialized = 1;
+	} else {
+	    numvars[n].cp = NULL;
+	}
+    }
+
+    if (specialized) {
+	for (n = 0; n < spec_count; ++n)
+	    type_walk(spec_blocks[n], 1);
+    }
+}
+
+/* cp is about to be assigned a value which may not be a number */
+void
+code_unspecialize(CELL *cp)
+{
+    INST *p;
+    int n;
+
+    if (!specialized || numvar_find(cp) < 0)
+	return;
+
+    for (n = 0; n < spec_count; ++n) {
+	for (p = spec_blocks[n]; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	    if (isDoubleOp(p->op)) {
+		p->op = ((p->op >= D_EQ)
+			 ? _EQ + (p->op - D_EQ)
+			 : _ADD + (p->op - D_ADD));
+	    }
+	}
+    }
+    specialized = 0;
+}
+
+/*
+ * Inlining.  A call of a small function whose parameters are all scalars,
+ * and whose body has no calls, loops over arrays, next or exit, is
+ * replaced by a copy of that body between _ICALL and _IRET.
+ * The arguments are pushed as for _CALL; _ICALL pushes the locals and
+ * points fp at them, so the copied L_PUSHI and L_PUSHA are unchanged, and
+ * each return becomes an _IRET which leaves the value in place of the
+ * arguments and jumps past the body.  The copy shares the operands of the
+ * function's code, which remains for other calls and for -W dump.
+ */
+
+#define INLINE_MAX  32		/* slots for the largest body, and its frame */
+
+/* can this opcode be copied to another code block? */
+static int
+inlinable_op(int op)
+{
+    switch ((MAWK_OPCODES) op) {
+    case _POP:
+    case _PUSHA:
+    case _PUSHI:
+    case _PUSHC:
+    case _PUSHD:
+    case _PUSHS:
+    case _PUSHINT:
+    case L_PUSHA:
+    case L_PUSHI:
+    case F_PUSHA:
+    case F_PUSHI:
+    case NF_PUSHI:
+    case FE_PUSHA:
+    case FE_PUSHI:
+    case A_PUSHA:
+    case AE_PUSHA:
+    case AE_PUSHI:
+    case A_CAT:
+    case A_TEST:
+    case _ADD:
+    case _SUB:
+    case _MUL:
+    case _DIV:
+    case _MOD:
+    case _POW:
+    case _NOT:
+    case _TEST:
+    case _UMINUS:
+    case _UPLUS:
+    case _CAT:
+    case _ASSIGN:
+    case _ADD_ASG:
+    case _SUB_ASG:
+    case _MUL_ASG:
+    case _DIV_ASG:
+    case _MOD_ASG:
+    case _POW_ASG:
+    case F_ASSIGN:
+    case F_ADD_ASG:
+    case F_SUB_ASG:
+    case F_MUL_ASG:
+    case F_DIV_ASG:
+    case F_MOD_ASG:
+    case F_POW_ASG:
+    case _POST_INC:
+    case _POST_DEC:
+    case _PRE_INC:
+    case _PRE_DEC:
+    case F_POST_INC:
+    case F_POST_DEC:
+    case F_PRE_INC:
+    case F_PRE_DEC:
+    case _EQ:
+    case _NEQ:
+    case _LT:
+    case _LTE:
+    case _GT:
+    case _GTE:
+    case _MATCH0:
+    case _MATCH1:
+    case _MATCH2:
+    case _JMP:
+    case _JZ:
+    case _JNZ:
+    case _LJZ:
+    case _LJNZ:
+    case _BUILTIN:
+    case _PRINT:
+    case _RET:
+    case _RET0:
+	return 1;
+    default:
+	return 0;
+    }
+}
+
+/* the number of slots of code at base, up to its first _HALT */
+static int
+code_length(INST * base)
+{
+    INST *p = base;
+
+    while (p->op != _HALT)
+	p += 1 + operand_count(p->op);
+    return (int) (p - base);
+}
+
+/*
+ * Each return in fbp's body becomes an _IRET, one slot longer.  The
+ * _RET0 which ends every function is dropped when it cannot be reached;
+ * when it can, the function is not inlined.  Returns the size of the
+ * inlined body, or -1.
+ */
+static int
+inline_size(const FBLOCK * fbp)
+{
+    INST *base = fbp->code;
+    INST *p;
+    char *targets;
+    int prev = _HALT;
+    int size = 0;
+    int n;
+
+    for (n = 0; n < (int) fbp->nargs; ++n) {
+	if (fbp->typev[n] != ST_LOCAL_VAR && fbp->typev[n] != ST_LOCAL_NONE)
+	    return -1;
+    }
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	if (!inlinable_op(p->op) || p - base > INLINE_MAX)
+	    return -1;
+    }
+
+    targets = jump_targets(base);
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	if (p->op == _RET0) {
+	    if (prev != _RET || targets[p - base]) {
+		size = -1;
+		break;
+	    }
+	} else {
+	    size += 1 + operand_count(p->op) + (p->op == _RET);
+	}
+	prev = p->op;
+    }
+    zfree(targets, (size_t) code_length(base) + 1);
+
+    if (size > INLINE_MAX - (int) fbp->nargs)
+	size = -1;
+    return size;
+}
+
+/* r is copied from p, at index i of the old code and j of the new */
+static void
+relocate(INST * r, const INST * p, int i, int j, const int *map)
+{
+    int k;
+
+    switch ((MAWK_OPCODES) p->op) {
+    case _JMP:
+    case _JZ:
+    case _JNZ:
+    case _LJZ:
+    case _LJNZ:
+    case SET_ALOOP:
+    case ALOOP:
+	r[1].op = map[i + 1 + p[1].op] - (j + 1);
+	break;
+    case _RANGE:
+	for (k = 2; k <= 4; ++k) {
+	    r[k].op = map[i + 1 + p[k].op] - (j + 1);
+	}
+	break;
+    default:
+	break;
+    }
+}
+
+/* copy fbp's body, which inline_size() made size slots, to q */
+static void
+inline_body(const FBLOCK * fbp, INST * q, int size)
+{
+    INST *base = fbp->code;
+    int length = code_length(base);
+    int *map = (int *) zmalloc(sizeof(int) * (size_t) (length + 1));
+    INST *p;
+    int i, j;
+
+    j = 0;
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	map[p - base] = j;
+	if (p->op != _RET0)
+	    j += 1 + operand_count(p->op) + (p->op == _RET);
+    }
+    map[length] = j;
+
+    for (p = base; p->op != _HALT; p += 1 + operand_count(p->op)) {
+	i = (int) (p - base);
+	j = map[i];
+	if (p->op == _RET) {
+	    q[j].op = _IRET;
+	    q[j + 1].op = size - (j + 1);
+	} else if (p->op != _RET0) {
+	    memcpy(q + j, p, INST_BYTES(1 + operand_count(p->op)));
+	    relocate(q + j, p, i, j, map);
+	}
+    }
+    zfree(map, sizeof(int) * (size_t) (length + 1));
+}
+
+static INST *rewrite_base;	/* the code being rewritten */
+static int *rewrite_map;	/* the new index of each of its instructions */
+
+/* copy the instruction at p to q, at index j of the new code */
+static int
+copy_inst(INST * p, INST * q, int j)
+{
+    int n = 1 + operand_count(p->op);
+
+    if (q != NULL) {
+	memcpy(q, p, INST_BYTES(n));
+	relocate(q, p, (int) (p - rewrite_base), j, rewrite_map);
+    }
+    return n;
+}
+
+/*
+ * Rebuild a code block, replacing each instruction p by the code which
+ * rewrite(p, q, j) writes at q, index j of the new block.  It is called
+ * first with a null q, to return the size of that code.  Jumps are
+ * relocated by copy_inst().
+ */
+static void
+rewrite_block(INST ** basep, size_t *sizep, int (*rewrite) (INST *, INST *, int))
+{
+    INST *base = *basep;
+    int length = (int) (*sizep / sizeof(INST));
+    int *map;
+    INST *code;
+    INST *p;
+    int size;
+
+    /* range patterns put _HALT inside the block, so walk all of it */
+    map = (int *) zmalloc(sizeof(int) * (size_t) (length + 1));
+    rewrite_base = base;
+    size = 0;
+    for (p = base; p < base + length; p += 1 + operand_count(p->op)) {
+	map[p - base] = size;
+	size += rewrite(p, (INST *) 0, 0);
+    }
+    map[length] = size;
+
+    if (p != base + length || size == length) {
+	zfree(map, sizeof(int) * (size_t) (length + 1));
+	return;
+    }
+
+    rewrite_map = map;
+    code = (INST *) zmalloc(INST_BYTES(size));
+    for (p = base; p < base + length; p += 1 + operand_count(p->op)) {
+	(void) rewrite(p, code + map[p - base], map[p - base]);
+    }
+
+    if (base == main_start)
+	next_label = code + map[next_label - base];
+    if (base == execution_start)
+	execution_start = code;
+
+    zfree(map, sizeof(int) * (size_t) (length + 1));
+    zfree(base, *sizep);
+    *basep = code;
+    *sizep = INST_BYTES(size);
+}
+
+static int
+inline_inst(INST * p, INST * q, int j)
+{
+    FBLOCK *fbp;
+    int n;
+
+    if (p->op == _CALL) {
+	fbp = (FBLOCK *) p[1].ptr;
+	if ((n = inline_size(fbp)) >= 0) {
+	    if (q != NULL) {
+		q[0].op = _ICALL;
+		q[1].op = n;
+		q[2].ptr = (PTR) fbp;
+		q[3].op = p[2].op;
+		inline_body(fbp, q + 4, n);
+	    }
+	    return 4 + n;
+	}
+    }
+    return copy_inst(p, q, j);
+}
+
+/* replace the calls of small functions in a code block by their bodies */
+static void
+inline_block(INST ** basep, size_t *sizep)
+{
+    rewrite_block(basep, sizep, inline_inst);
+}
+
+/* called after resolve_fcalls(), before code_fuse() */
+void
+code_inline(void)
+{
+    each_block(inline_block);
+}
+
+/*
+ * Hoisting.  A for or while loop is coded as a jump to its test, which
+ * follows the body and jumps back to the start of the body.  When the
+ * loop cannot change $0, the fields or NF, the test in NF_PUSHI which
+ * splits $0 is done once by an NF_PUSHI and _POP before that jump, and
+ * each NF_PUSHI in the loop becomes a _PUSHI of NF.  Code fusion can then
+ * make "i <= NF" a single compare and jump.
+ */
+
+#define HOIST_ENTRY 1		/* the jump into a loop */
+#define HOIST_NF    2		/* an NF_PUSHI inside it */
+
+static char *hoist_marks;
+
+/* does the instruction at p leave $0, the fields and NF alone? */
+static int
+keeps_fields(INST * p)
+{
+    switch ((MAWK_OPCODES) p->op) {
+    case F_PUSHA:
+    case FE_PUSHA:
+	/* only assignments, sub(), gsub() and getline take the address */
+	return 0;
+    case _BUILTIN:
+	/* only getline reads a record */
+	return (p[1].fnc != bi_getline);
+    case _CALL:
+    case _CALLX:
+    case _RANGE:
+    case _OMAIN:
+    case _JMAIN:
+    case OL_GL:
+    case OL_GL_NR:
+	return 0;
+    default:
+	return 1;
+    }
+}
+
+/* the target of operand k of a jump at index i of base, or -1 */
+static int
+jump_target(INST * base, int i, int k)
+{
+    INST *p = base + i;
+
+    switch ((MAWK_OPCODES) p->op) {
+    case _JMP:
+    case _JZ:
+    case _JNZ:
+    case _LJZ:
+    case _LJNZ:
+    case SET_ALOOP:
+    case ALOOP:
+    case _IRET:
+	return (k == 1) ? (i + 1 + p[1].op) : -1;
+    case _RANGE:
+	return (k >= 2 && k <= 4) ? (i + 1 + p[k].op) : -1;
+    default:
+	return -1;
+    }
+}
+
+/*
+ * Check the loop from the body at start to the jump back at last, which
+ * is entered by the jump at entry.
+ */
+static int
+hoistable(INST * base, int length, int entry, int start, int last)
+{
+    int end = last + 2;
+    int nf_loads = 0;
+    int i, k, t;
+
+    for (i = start; i < end; i += 1 + operand_count(base[i].op)) {
+	if (!keeps_fields(base + i))
+	    return 0;
+	if (base[i].op == NF_PUSHI)
+	    nf_loads++;
+    }
+    if (nf_loads == 0)
+	return 0;
+
+    /* nothing else may jump into the loop */
+    for (i = 0; i < length; i += 1 + operand_count(base[i].op)) {
+	if (i == entry || (i >= start && i < end))
+	    continue;
+	for (k = 1; k <= 4; ++k) {
+	    t = jump_target(base, i, k);
+	    if (t >= start && t < end)
+		return 0;
+	}
+    }
+    return 1;
+}
+
+static int
+hoist_inst(INST * p, INST * q, int j)
+{
+    switch (hoist_marks[p - rewrite_base]) {
+    case HOIST_ENTRY:
+	if (q != NULL) {
+	    q[0].op = NF_PUSHI;
+	    q[1].op = _POP;
+	}
+	return 2 + copy_inst(p, (q != NULL) ? (q + 2) : q, j + 2);
+    case HOIST_NF:
+	if (q != NULL) {
+	    q[0].op = _PUSHI;
+	    q[1].ptr = (PTR) NF;
+	}
+	return 2;
+    default:
+	return copy_inst(p, q, j);
+    }
+}
+
+static void
+hoist_block(INST ** basep, size_t *sizep)
+{
+    INST *base = *basep;
+    int length = (int) (*sizep / sizeof(INST));
+    int *prev;
+    int hoisted = 0;
+    int i, k, last, start, entry;
+
+    prev = (int *) zmalloc(sizeof(int) * (size_t) (length + 1));
+    hoist_marks = (char *) zmalloc((size_t) length + 1);
+    memset(hoist_marks, 0, (size_t) length + 1);
+
+    k = -1;
+    for (i = 0; i < length; i += 1 + operand_count(base[i].op)) {
+	prev[i] = k;
+	k = i;
+    }
+
+    for (last = 0; i == length && last < length;
+	 last += 1 + operand_count(base[last].op)) {
+	if (base[last].op != _JNZ && base[last].op != _JZ)
+	    continue;
+	start = jump_target(base, last, 1);
+	if (start >= last || (entry = prev[start]) < 0
+	    || base[entry].op != _JMP)
+	    continue;
+	k = jump_target(base, entry, 1);
+	if (k <= start || k > last
+	    || !hoistable(base, length, entry, start, last))
+	    continue;
+
+	hoist_marks[entry] = HOIST_ENTRY;
+	for (k = start; k <= last; k += 1 + operand_count(base[k].op)) {
+	    if (base[k].op == NF_PUSHI)
+		hoist_marks[k] = HOIST_NF;
+	}
+	hoisted = 1;
+    }
+
+    if (hoisted)
+	rewrite_block(basep, sizep, hoist_inst);
+
+    zfree(hoist_marks, (size_t) length + 1);
+    zfree(prev, sizeof(int) * (size_t) (length + 1));
+}
+
+/* called after code_inline(), before code_fuse() */
+void
+code_hoist(void)
+{
+    each_block(hoist_block);
+}
+
 #ifdef NO_LEAKS
 void
 free_cell_data(CELL *cp)
@@ -301,6 +1394,8 @@ free_codes(const char *tag, INST * base, size_t size)
 	    switch ((MAWK_OPCODES) (cdp->op)) {
 	    case AE_PUSHA:
 	    case AE_PUSHI:
+	    case AE_INCDEC:
+	    case AE_INCDEC_V:
 		++cdp;		/* skip pointer */
 		cp = (CELL *) (cdp->ptr);
 		if (cp != NULL) {
@@ -326,9 +1421,14 @@ free_codes(const char *tag, INST * base, size_t size)
 	    case _PUSHA:
 	    case _PUSHI:
 	    case _PUSHINT:
+	    case _JCMP_I:
+	    case _ARITH_I:
+	    case _INCDEC:
 		++cdp;		/* skip value */
 		break;
 	    case _PUSHD:
+	    case _JCMP_D:
+	    case _ARITH_D:
 		++cdp;		/* skip value */
 		if (cdp->ptr != &double_one && cdp->ptr != &double_zero)
 		    zfree(cdp->ptr, sizeof(double));
@@ -346,7 +1446,11 @@ free_codes(const char *tag, INST * base, size_t size)
 		break;
 	    case _CALLX:
 	    case _CALL:
-		cdp += 1 + cdp[2].op;
+		cdp += 2;	/* skip function and argument count */
+		break;
+	    case _ICALL:
+		/* the inlined body shares the function's operands */
+		cdp += 3 + cdp[1].op;
 		break;
 	    case A_DEL:
 	    case A_LENGTH:
@@ -410,6 +1514,20 @@ free_codes(const char *tag, INST * base, size_t size)
 	    case _TEST:
 	    case _UMINUS:
 	    case _UPLUS:
+	    case _ASSIGN_POP:
+	    case _ADD_ASG_POP:
+	    case D_ADD:
+	    case D_SUB:
+	    case D_MUL:
+	    case D_DIV:
+	    case D_MOD:
+	    case D_POW:
+	    case D_EQ:
+	    case D_NEQ:
+	    case D_LT:
+	    case D_LTE:
+	    case D_GT:
+	    case D_GTE:
 		break;
 	    case _JNZ:
 	    case _JZ:
@@ -420,6 +1538,7 @@ free_codes(const char *tag, INST * base, size_t size)
 	    case ALOOP:
 	    case LAE_PUSHI:
 	    case SET_ALOOP:
+	    case _IRET:
 		++cdp;		/* cdp->op is literal param */
 		break;
 	    }
@@ -447,5 +1566,11 @@ code_leaks(void)
 	main_start = NULL;
 	main_size = 0;
     }
+    if (numvars != NULL)
+	zfree(numvars, (size_t) numvar_limit * sizeof(NUMVAR));
+    if (numdeps != NULL)
+	zfree(numdeps, (size_t) numdep_limit * sizeof(NUMDEP));
+    if (spec_blocks != NULL)
+	zfree(spec_blocks, (size_t) spec_limit * sizeof(INST *));
 }
 #endif
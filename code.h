@@ -61,6 +61,8 @@ extern int dump_code_flag;
 extern CELL eval_stack[];
 extern int exit_code;
 
+void eval_stacks(void (*)(CELL *, size_t));
+
 #define  code1(x)  code_ptr++ -> op = (x)
 /* shutup picky compilers */
 #define  code2(x,p)  xcode2(x,(PTR)(p))
@@ -73,6 +75,12 @@ INST *code_shrink(CODEBLOCK *, size_t *);
 void code_grow(void);
 void set_code(void);
 void be_setup(int);
+void code_discard(INST *, INST *);
+void code_inline(void);
+void code_hoist(void);
+void code_fuse(void);
+void code_specialize(void);
+void code_unspecialize(CELL *);
 void dump_code(void);
 
 /*  the machine opcodes  */
@@ -172,6 +180,33 @@ typedef enum {
     ,_OMAIN
     ,_JMAIN
     ,DEL_A
+    /* superinstructions, made by code_fuse() */
+    ,_JCMP_D
+    ,_JCMP_I
+    ,_ARITH_D
+    ,_ARITH_I
+    ,_INCDEC
+    ,AE_INCDEC
+    ,AE_INCDEC_V
+    ,_ASSIGN_POP
+    ,_ADD_ASG_POP
+    /* _ADD ... _POW and _EQ ... _GTE for operands known to be numbers,
+       made by code_specialize() */
+    ,D_ADD
+    ,D_SUB
+    ,D_MUL
+    ,D_DIV
+    ,D_MOD
+    ,D_POW
+    ,D_EQ
+    ,D_NEQ
+    ,D_LT
+    ,D_LTE
+    ,D_GT
+    ,D_GTE
+    /* a function body copied into its caller, made by code_inline() */
+    ,_ICALL
+    ,_IRET
 } MAWK_OPCODES;
 
 #endif /* MAWK_CODE_H */
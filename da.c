@@ -120,6 +120,20 @@ static const OP_NAME simple_code[] =
     { _JMAIN,     "jmain" },
     { OL_GL,      "ol_gl" },
     { OL_GL_NR,   "ol_gl_nr" },
+    { _ASSIGN_POP, "assign_pop" },
+    { _ADD_ASG_POP, "add_asg_pop" },
+    { D_ADD,      "d_add" },
+    { D_SUB,      "d_sub" },
+    { D_MUL,      "d_mul" },
+    { D_DIV,      "d_div" },
+    { D_MOD,      "d_mod" },
+    { D_POW,      "d_pow" },
+    { D_EQ,       "d_eq" },
+    { D_NEQ,      "d_neq" },
+    { D_LT,       "d_lt" },
+    { D_LTE,      "d_lte" },
+    { D_GT,       "d_gt" },
+    { D_GTE,      "d_gte" },
     { _HALT,      "" }
 } ;
 /* *INDENT-ON* */
@@ -243,6 +257,8 @@ da_this(INST * p, const INST * start, FILE *fp)
 	break;
 
     case _PUSHD:
+    case _JCMP_D:
+    case _ARITH_D:
 	fprintf(fp, "%s\t%.6g\n", op_name, *(double *) p++->ptr);
 	break;
 
@@ -262,10 +278,13 @@ da_this(INST * p, const INST * start, FILE *fp)
 	break;
 
     case _PUSHA:
+    case _INCDEC:
 	fprintf(fp, "%s\t%s\n", op_name, reverse_find(ST_VAR, &p++->ptr));
 	break;
 
     case _PUSHI:
+    case _JCMP_I:
+    case _ARITH_I:
 	cp = (CELL *) p++->ptr;
 	if (cp == field)
 	    fprintf(fp, "%s\t$0\n", op_name);
@@ -273,7 +292,7 @@ da_this(INST * p, const INST * start, FILE *fp)
 	    fprintf(fp, "%s\t@fs_shadow\n", op_name);
 	else {
 	    const char *name;
-	    if (cp > NF && cp <= LAST_PFIELD)
+	    if (cp >= NF && cp <= LAST_PFIELD)
 		name = reverse_find(ST_FIELD, &cp);
 	    else
 		name = reverse_find(ST_VAR, &cp);
@@ -306,6 +325,8 @@ da_this(INST * p, const INST * start, FILE *fp)
     case AE_PUSHA:
     case AE_PUSHI:
     case A_PUSHA:
+    case AE_INCDEC:
+    case AE_INCDEC_V:
 	fprintf(fp, "%s\t%s\n", op_name, reverse_find(ST_ARRAY, &p++->ptr));
 	break;
 
@@ -391,6 +412,7 @@ da_this(INST * p, const INST * start, FILE *fp)
 	break;
 
     case ALOOP:
+    case _IRET:
 	fprintf(fp, "%s\t%03ld\n", op_name, LABEL(p));
 	p++;
 	break;
@@ -404,6 +426,11 @@ da_this(INST * p, const INST * start, FILE *fp)
 	p += 2;
 	break;
 
+    case _ICALL:
+	fprintf(fp, "%s\t%s\t%d\n", op_name, ((FBLOCK *) p[1].ptr)->name, p[2].op);
+	p += 3;
+	break;
+
     case _RANGE:
 	fprintf(fp, "%s\t%03ld %03ld %03ld\n", op_name,
 	/* label for pat2, action, follow */
@@ -450,6 +477,8 @@ special_cases[] =
     { bi_split,    "split" },
     { bi_length,   "length" },
     { bi_alength,  "alength" },
+    { bi_asort,    "asort" },
+    { bi_asorti,   "asorti" },
     { bi_match,    "match" },
     { bi_getline,  "getline" },
     { bi_sub,      "sub" },
@@ -546,7 +575,8 @@ static const OP_NAME type_names[] =
     {C_SPACE,     "space"},
     {C_SNULL,     "snull"},
     {C_REPL,      "repl"},
-    {C_REPLV,     "replv"}
+    {C_REPLV,     "replv"},
+    {C_PAIR,      "pair"}
 };
 /* *INDENT-ON* */
 
@@ -582,6 +612,8 @@ static const OP_NAME other_codes[] = {
     { SET_ALOOP,  "set_al" },
     { _CALL,      "call" },
     { _CALLX,     "callx" },
+    { _ICALL,     "icall" },
+    { _IRET,      "iret" },
     { _JMP,       "jmp" },
     { _JNZ,       "jnz" },
     { _JZ,        "jz" },
@@ -598,6 +630,13 @@ static const OP_NAME other_codes[] = {
     { _RANGE,     "range" },
     { _LENGTH,    "defer_len" },
     { A_LENGTH,   "defer_alen" },
+    { _JCMP_D,    "jcmp_d" },
+    { _JCMP_I,    "jcmp_i" },
+    { _ARITH_D,   "arith_d" },
+    { _ARITH_I,   "arith_i" },
+    { _INCDEC,    "incdec" },
+    { AE_INCDEC,  "ae_incdec" },
+    { AE_INCDEC_V,"ae_incdec_v" },
     { _HALT,      "" }
 };
 /* *INDENT-ON* */
@@ -39,18 +39,46 @@ the GNU General Public License, version 2, 1991.
 #if defined(HAVE_ISNAN)
 static int compare2(CELL *, int);
 #define CompareCells(p,n) compare2(p,n)
+static int compare_d2(CELL *, int);
+#define CompareDoubles(p,n) compare_d2(p,n)
 #else
 static int compare(CELL *);
 #define CompareCells(p,n) compare(p)
+static int compare_d(CELL *);
+#define CompareDoubles(p,n) compare_d(p)
 #endif
 
 static int d_to_index(double);
+static int compare_op(CELL *, int);
+static int test_order(int, int);
 
 #ifdef	 NOINFO_SIGFPE
 static char dz_msg[] = "division by zero";
 #define	 CHECK_DIVZERO(x) do { if ((x) == 0.0 ) rt_error(dz_msg); } while (0)
 #endif
 
+/*
+ * Where the compiler supports labels as values (gcc and clang), dispatch
+ * through a table of handler addresses rather than the switch statement.
+ * The jump at the top of the loop is duplicated into each handler, so each
+ * opcode has its own indirect branch, which predicts much better than the
+ * single branch of the switch.  Build with -DUSE_THREADED_CODE=0 to use
+ * only the switch.
+ */
+#ifndef USE_THREADED_CODE
+#if defined(__GNUC__) && !defined(__STRICT_ANSI__)
+#define USE_THREADED_CODE 1
+#else
+#define USE_THREADED_CODE 0
+#endif
+#endif
+
+#if USE_THREADED_CODE
+#define OP_LABEL(name) op##name:
+#else
+#define OP_LABEL(name)		/* nothing */
+#endif
+
 #define	 SAFETY	   16
 #define	 DANGER	   (EVAL_STACK_SIZE - SAFETY - MAX_ARGS)
 
@@ -89,9 +117,7 @@ eval_underflow(void)
 typedef struct aloop_state {
     struct aloop_state *link;
     CELL *var;			/* for(var in A) */
-    STRING **base;
-    STRING **ptr;
-    STRING **limit;
+    ARRAY_LOOP loop;
 } ALOOP_STATE;
 
 /* clean up aloop stack on next, return, exit */
@@ -109,21 +135,74 @@ clear_aloop_stack(ALOOP_STATE * top)
     ALOOP_STATE *q;
 
     do {
-	while (top->ptr < top->limit) {
-	    free_STRING(*top->ptr);
-	    top->ptr++;
-	}
-	if (top->base < top->limit) {
-	    zfree(top->base,
-		  (unsigned) (top->limit - top->base) * sizeof(STRING *));
-	}
+	array_loop_close(top->loop);
 	q = top;
 	top = q->link;
 	ZFREE(q);
     } while (top);
 }
 
+/*
+ * A call of a user function, pushed by _CALL and popped by _RET.  Calls
+ * stay in the same activation of execute(), so recursion in the awk
+ * program does not recurse in C.
+ */
+typedef struct {
+    INST *cdp;			/* where the caller continues */
+    CELL *fp;			/* the caller's frame */
+    CELL *sp;			/* caller's stack, after the callee's locals */
+    CELL *old_stack_base;	/* set if the callee changed stacks */
+    ALOOP_STATE *aloop_state;	/* the caller's array loops */
+    FBLOCK *fbp;		/* the callee */
+    int a_args;			/* number of arguments passed */
+#ifdef	DEBUG
+    CELL *entry_sp;
+#endif
+} CALL_FRAME;
+
+static CALL_FRAME *call_stack;
+static size_t call_limit;
+static size_t call_depth;
+
+static CALL_FRAME *
+push_call_frame(void)
+{
+    if (call_depth == call_limit) {
+	size_t old = call_limit * sizeof(CALL_FRAME);
+
+	call_limit = (call_limit == 0) ? 64 : (2 * call_limit);
+	if (call_stack == NULL)
+	    call_stack = (CALL_FRAME *) zmalloc(call_limit * sizeof(CALL_FRAME));
+	else
+	    call_stack = (CALL_FRAME *) zrealloc(call_stack, old,
+						 call_limit * sizeof(CALL_FRAME));
+    }
+    return &call_stack[call_depth++];
+}
+
+/*
+ * "return f(...)" can reuse the frame of the function returning, unless
+ * that function has local arrays (which f may be passed), or changed
+ * stacks.  The arguments of f must be the only things above its locals.
+ */
+static int
+can_tail_call(const CALL_FRAME * frame, const CELL *nfp)
+{
+    const FBLOCK *fbp = frame->fbp;
+    int n;
+
+    if (frame->old_stack_base != NULL || nfp != frame->sp + 1)
+	return 0;
+    for (n = frame->a_args; n < (int) fbp->nargs; ++n) {
+	if (fbp->typev[n] == ST_LOCAL_ARRAY)
+	    return 0;
+    }
+    return 1;
+}
+
 INST *next_label;		/* control flow label */
+static INST *restart_label;	/* control flow label */
+static CELL missing;		/* no value (use zero) */
 
 void
 execute(INST * cdp,		/* code ptr, start execution here */
@@ -131,25 +210,55 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	CELL *fp)		/* frame ptr into eval_stack for
 				   user defined functions */
 {
-    static INST *restart_label;	/* control flow label */
-    static CELL tc;		/* useful temp */
-    static CELL missing;	/* no value (use zero) */
-
     /* some useful temporaries */
+    CELL tc;
     CELL *cp;
     int t;
 
     /* save state for array loops via a stack */
     ALOOP_STATE *aloop_state = (ALOOP_STATE *) 0;
 
-    /* for moving the eval stack on deep recursion */
-    CELL *old_stack_base = NULL;
-    CELL *old_sp = NULL;
+    /* calls made by this activation are above this */
+    size_t frame_base = call_depth;
+
+    /* the caller's fp while running an inlined function */
+    CELL *inline_fp = NULL;
 
 #ifdef	DEBUG
     CELL *entry_sp;
 #endif
 
+#if USE_THREADED_CODE
+    /* handler addresses, in the order of MAWK_OPCODES */
+    static const void *const op_labels[] =
+    {
+	&&opFE_PUSHA, &&opFE_PUSHI, &&opF_PUSHA, &&opF_PUSHI, &&opNF_PUSHI,
+	&&op_HALT, &&op_STOP, &&op_PUSHC, &&op_PUSHD, &&op_PUSHS,
+	&&op_PUSHINT, &&op_PUSHA, &&op_PUSHI, &&opL_PUSHA, &&opL_PUSHI,
+	&&opAE_PUSHA, &&opAE_PUSHI, &&opA_PUSHA, &&opLAE_PUSHA,
+	&&opLAE_PUSHI, &&opLA_PUSHA, &&op_POP, &&op_ADD, &&op_SUB,
+	&&op_MUL, &&op_DIV, &&op_MOD, &&op_POW, &&op_NOT, &&op_TEST,
+	&&opA_TEST, &&op_LENGTH, &&opA_LENGTH, &&opA_DEL, &&opALOOP,
+	&&opA_CAT, &&op_UMINUS, &&op_UPLUS, &&op_ASSIGN, &&op_ADD_ASG,
+	&&op_SUB_ASG, &&op_MUL_ASG, &&op_DIV_ASG, &&op_MOD_ASG,
+	&&op_POW_ASG, &&opF_ASSIGN, &&opF_ADD_ASG, &&opF_SUB_ASG,
+	&&opF_MUL_ASG, &&opF_DIV_ASG, &&opF_MOD_ASG, &&opF_POW_ASG,
+	&&op_CAT, &&op_BUILTIN, &&op_PRINT, &&op_POST_INC, &&op_POST_DEC,
+	&&op_PRE_INC, &&op_PRE_DEC, &&opF_POST_INC, &&opF_POST_DEC,
+	&&opF_PRE_INC, &&opF_PRE_DEC, &&op_JMP, &&op_JNZ, &&op_JZ,
+	&&op_LJZ, &&op_LJNZ, &&op_EQ, &&op_NEQ, &&op_LT, &&op_LTE, &&op_GT,
+	&&op_GTE, &&op_MATCH0, &&op_MATCH1, &&op_MATCH2, &&op_EXIT,
+	&&op_EXIT0, &&op_NEXT, &&op_NEXTFILE, &&op_RANGE, &&op_CALL,
+	&&op_CALLX, &&op_RET, &&op_RET0, &&opSET_ALOOP, &&opPOP_AL,
+	&&opOL_GL, &&opOL_GL_NR, &&op_OMAIN, &&op_JMAIN, &&opDEL_A,
+	&&op_JCMP_D, &&op_JCMP_I, &&op_ARITH_D, &&op_ARITH_I, &&op_INCDEC,
+	&&opAE_INCDEC, &&opAE_INCDEC_V, &&op_ASSIGN_POP, &&op_ADD_ASG_POP, &&opD_ADD,
+	&&opD_SUB, &&opD_MUL, &&opD_DIV, &&opD_MOD, &&opD_POW, &&opD_EQ,
+	&&opD_NEQ, &&opD_LT, &&opD_LTE, &&opD_GT, &&opD_GTE, &&op_ICALL,
+	&&op_IRET
+    };
+#endif
+
     if (sp == NULL) {
 	stack_under = stack_base;
 	sp = --stack_under;
@@ -158,23 +267,6 @@ execute(INST * cdp,		/* code ptr, start execution here */
     entry_sp = sp;
 #endif
 
-    if (fp) {
-	/* we are a function call, check for deep recursion */
-	if (sp > stack_danger) {	/* change stacks */
-	    old_stack_base = stack_base;
-	    old_sp = sp;
-	    stack_base = (CELL *) zmalloc(sizeof(CELL) * EVAL_STACK_SIZE);
-	    stack_danger = stack_base + DANGER;
-	    sp = stack_base;
-	    /* waste 1 slot for ANSI, actually large model msdos breaks in
-	       RET if we don't */
-#ifdef	DEBUG
-	    entry_sp = sp;
-#endif
-	} else
-	    old_stack_base = (CELL *) 0;
-    }
-
     while (1) {
 
 	TRACE(("execute %s sp(%ld:%s)\n",
@@ -182,38 +274,41 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	       (long) (sp - stack_base),
 	       (sp == stack_under) ? "?" : da_type_name(sp)));
 
+#if USE_THREADED_CODE
+	goto *op_labels[(cdp++)->op];
+#endif
 	switch ((cdp++)->op) {
 
 /* HALT only used by the disassemble now ; this remains
    so compilers don't offset the jump table */
-	case _HALT:
+	case _HALT: OP_LABEL(_HALT)
 
-	case _STOP:		/* only for range patterns */
+	case _STOP: OP_LABEL(_STOP)		/* only for range patterns */
 #ifdef	DEBUG
 	    if (sp != entry_sp + 1)
 		bozo("stop0");
 #endif
 	    return;
 
-	case _PUSHC:
+	case _PUSHC: OP_LABEL(_PUSHC)
 	    inc_sp();
 	    cellcpy(sp, (cdp++)->ptr);
 	    break;
 
-	case _PUSHD:
+	case _PUSHD: OP_LABEL(_PUSHD)
 	    inc_sp();
 	    sp->type = C_DOUBLE;
 	    sp->dval = *(double *) (cdp++)->ptr;
 	    break;
 
-	case _PUSHS:
+	case _PUSHS: OP_LABEL(_PUSHS)
 	    inc_sp();
 	    sp->type = C_STRING;
 	    sp->ptr = (cdp++)->ptr;
 	    string(sp)->ref_cnt++;
 	    break;
 
-	case F_PUSHA:
+	case F_PUSHA: OP_LABEL(F_PUSHA)
 	    cp = (CELL *) cdp->ptr;
 	    if (cp != field) {
 		if (nf < 0)
@@ -235,19 +330,19 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    /* FALLTHRU */
 
-	case _PUSHA:
-	case A_PUSHA:
+	case _PUSHA: OP_LABEL(_PUSHA)
+	case A_PUSHA: OP_LABEL(A_PUSHA)
 	    inc_sp();
 	    sp->ptr = (cdp++)->ptr;
 	    break;
 
-	case _PUSHI:
+	case _PUSHI: OP_LABEL(_PUSHI)
 	    /* put contents of next address on stack */
 	    inc_sp();
 	    cellcpy(sp, (cdp++)->ptr);
 	    break;
 
-	case L_PUSHI:
+	case L_PUSHI: OP_LABEL(L_PUSHI)
 	    /* put the contents of a local var on stack,
 	       cdp->op holds the offset from the frame pointer */
 	    if (fp != NULL) {
@@ -256,7 +351,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case L_PUSHA:
+	case L_PUSHA: OP_LABEL(L_PUSHA)
 	    /* put a local address on eval stack */
 	    if (fp != NULL) {
 		inc_sp();
@@ -264,7 +359,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case F_PUSHI:
+	case F_PUSHI: OP_LABEL(F_PUSHI)
 
 	    /* push contents of $i
 	       cdp[0] holds & $i , cdp[1] holds i */
@@ -285,7 +380,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case NF_PUSHI:
+	case NF_PUSHI: OP_LABEL(NF_PUSHI)
 
 	    inc_sp();
 	    if (nf < 0)
@@ -293,7 +388,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cellcpy(sp, NF);
 	    break;
 
-	case FE_PUSHA:
+	case FE_PUSHA: OP_LABEL(FE_PUSHA)
 
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
@@ -312,7 +407,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case FE_PUSHI:
+	case FE_PUSHI: OP_LABEL(FE_PUSHI)
 
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
@@ -330,7 +425,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case AE_PUSHA:
+	case AE_PUSHA: OP_LABEL(AE_PUSHA)
 	    /* top of stack has an expr, cdp->ptr points at an
 	       array, replace the expr with the cell address inside
 	       the array */
@@ -340,30 +435,26 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->ptr = (PTR) cp;
 	    break;
 
-	case AE_PUSHI:
+	case AE_PUSHI: OP_LABEL(AE_PUSHI)
 	    /* top of stack has an expr, cdp->ptr points at an
 	       array, replace the expr with the contents of the
 	       cell inside the array */
 
-	    cp = array_find((ARRAY) (cdp++)->ptr, sp, CREATE);
-	    cell_destroy(sp);
-	    cellcpy(sp, cp);
+	    array_get((ARRAY) (cdp++)->ptr, sp);
 	    break;
 
-	case LAE_PUSHI:
+	case LAE_PUSHI: OP_LABEL(LAE_PUSHI)
 	    /*  sp[0] is an expression
 	       cdp->op is offset from frame pointer of a CELL which
 	       has an ARRAY in the ptr field, replace expr
 	       with  array[expr]
 	     */
 	    if (fp != NULL) {
-		cp = array_find((ARRAY) fp[(cdp++)->op].ptr, sp, CREATE);
-		cell_destroy(sp);
-		cellcpy(sp, cp);
+		array_get((ARRAY) fp[(cdp++)->op].ptr, sp);
 	    }
 	    break;
 
-	case LAE_PUSHA:
+	case LAE_PUSHA: OP_LABEL(LAE_PUSHA)
 	    /*  sp[0] is an expression
 	       cdp->op is offset from frame pointer of a CELL which
 	       has an ARRAY in the ptr field, replace expr
@@ -376,7 +467,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case LA_PUSHA:
+	case LA_PUSHA: OP_LABEL(LA_PUSHA)
 	    /*  cdp->op is offset from frame pointer of a CELL which
 	       has an ARRAY in the ptr field. Push this ARRAY
 	       on the eval stack
@@ -387,7 +478,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case A_LENGTH:
+	case A_LENGTH: OP_LABEL(A_LENGTH)
 	    /* parameter for length() was ST_NONE; improve it here */
 	    {
 		SYMTAB *stp = (SYMTAB *) cdp->ptr;
@@ -416,7 +507,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    /* resume, interpreting the updated code */
 	    break;
 
-	case _LENGTH:
+	case _LENGTH: OP_LABEL(_LENGTH)
 	    /* parameter for length() was ST_LOCAL_NONE; improve it here */
 	    {
 		DEFER_LEN *dl = (DEFER_LEN *) cdp->ptr;
@@ -450,14 +541,12 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    /* resume, interpreting the updated code */
 	    break;
 
-	case SET_ALOOP:
+	case SET_ALOOP: OP_LABEL(SET_ALOOP)
 	    {
 		ALOOP_STATE *ap = ZMALLOC(ALOOP_STATE);
-		size_t vector_size;
 
 		ap->var = (CELL *) sp[-1].ptr;
-		ap->base = ap->ptr = array_loop_vector((ARRAY) sp->ptr, &vector_size);
-		ap->limit = ap->base + vector_size;
+		ap->loop = array_loop_open((ARRAY) sp->ptr);
 		sp -= 2;
 
 		/* push onto aloop stack */
@@ -467,13 +556,13 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case ALOOP:
+	case ALOOP: OP_LABEL(ALOOP)
 	    {
 		ALOOP_STATE *ap = aloop_state;
-		if (ap != NULL && (ap->ptr < ap->limit)) {
+		CELL key;
+		if (ap != NULL && array_loop_next(ap->loop, &key)) {
 		    cell_destroy(ap->var);
-		    ap->var->type = C_MBSTRN;
-		    ap->var->ptr = (PTR) * ap->ptr++;
+		    *ap->var = key;
 		    cdp += cdp->op;
 		} else {
 		    cdp++;
@@ -481,32 +570,24 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case POP_AL:
+	case POP_AL: OP_LABEL(POP_AL)
 	    {
 		/* finish up an array loop */
 		ALOOP_STATE *ap = aloop_state;
 		if (ap != NULL) {
 		    aloop_state = ap->link;
-		    while (ap->ptr < ap->limit) {
-			free_STRING(*ap->ptr);
-			ap->ptr++;
-		    }
-		    if (ap->base < ap->limit) {
-			zfree(ap->base,
-			      ((size_t) (ap->limit - ap->base)
-			       * sizeof(STRING *)));
-		    }
+		    array_loop_close(ap->loop);
 		    ZFREE(ap);
 		}
 	    }
 	    break;
 
-	case _POP:
+	case _POP: OP_LABEL(_POP)
 	    cell_destroy(sp);
 	    dec_sp();
 	    break;
 
-	case _ASSIGN:
+	case _ASSIGN: OP_LABEL(_ASSIGN)
 	    /* top of stack has an expr, next down is an
 	       address, put the expression in *address and
 	       replace the address with the expression */
@@ -520,7 +601,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cell_destroy(sp + 1);
 	    break;
 
-	case F_ASSIGN:
+	case F_ASSIGN: OP_LABEL(F_ASSIGN)
 	    /* assign to a field  */
 	    if (sp->type == C_MBSTRN)
 		check_strnum(sp);
@@ -530,7 +611,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cellcpy(sp, (CELL *) sp->ptr);
 	    break;
 
-	case _ADD_ASG:
+	case _ADD_ASG: OP_LABEL(_ADD_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -549,7 +630,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case _SUB_ASG:
+	case _SUB_ASG: OP_LABEL(_SUB_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -567,7 +648,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case _MUL_ASG:
+	case _MUL_ASG: OP_LABEL(_MUL_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -585,7 +666,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case _DIV_ASG:
+	case _DIV_ASG: OP_LABEL(_DIV_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -608,7 +689,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case _MOD_ASG:
+	case _MOD_ASG: OP_LABEL(_MOD_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -625,7 +706,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case _POW_ASG:
+	case _POW_ASG: OP_LABEL(_POW_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -637,7 +718,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = cp->dval;
 	    break;
 
-	case F_ADD_ASG:
+	case F_ADD_ASG: OP_LABEL(F_ADD_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -655,7 +736,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_SUB_ASG:
+	case F_SUB_ASG: OP_LABEL(F_SUB_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -673,7 +754,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_MUL_ASG:
+	case F_MUL_ASG: OP_LABEL(F_MUL_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -691,7 +772,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_DIV_ASG:
+	case F_DIV_ASG: OP_LABEL(F_DIV_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -714,7 +795,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_MOD_ASG:
+	case F_MOD_ASG: OP_LABEL(F_MOD_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -731,7 +812,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_POW_ASG:
+	case F_POW_ASG: OP_LABEL(F_POW_ASG)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    cp = (CELL *) (sp - 1)->ptr;
@@ -743,7 +824,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case _ADD:
+	case _ADD: OP_LABEL(_ADD)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
@@ -756,7 +837,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 #endif
 	    break;
 
-	case _SUB:
+	case _SUB: OP_LABEL(_SUB)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
@@ -769,7 +850,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 #endif
 	    break;
 
-	case _MUL:
+	case _MUL: OP_LABEL(_MUL)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
@@ -782,7 +863,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 #endif
 	    break;
 
-	case _DIV:
+	case _DIV: OP_LABEL(_DIV)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
@@ -800,7 +881,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 #endif
 	    break;
 
-	case _MOD:
+	case _MOD: OP_LABEL(_MOD)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
@@ -812,14 +893,14 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp[0].dval = fmod(sp[0].dval, sp[1].dval);
 	    break;
 
-	case _POW:
+	case _POW: OP_LABEL(_POW)
 	    dec_sp();
 	    if (TEST2(sp) != TWO_DOUBLES)
 		cast2_to_d(sp);
 	    sp[0].dval = pow(sp[0].dval, sp[1].dval);
 	    break;
 
-	case _NOT:
+	case _NOT: OP_LABEL(_NOT)
 	    /* evaluates to 0.0 or 1.0 */
 	  reswitch_1:
 	    switch (sp->type) {
@@ -846,7 +927,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->type = C_DOUBLE;
 	    break;
 
-	case _TEST:
+	case _TEST: OP_LABEL(_TEST)
 	    /* evaluates to 0.0 or 1.0 */
 	  reswitch_2:
 	    switch (sp->type) {
@@ -873,18 +954,18 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->type = C_DOUBLE;
 	    break;
 
-	case _UMINUS:
+	case _UMINUS: OP_LABEL(_UMINUS)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    sp->dval = -sp->dval;
 	    break;
 
-	case _UPLUS:
+	case _UPLUS: OP_LABEL(_UPLUS)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    break;
 
-	case _CAT:
+	case _CAT: OP_LABEL(_CAT)
 	    {
 		size_t len1, len2;
 		char *str1, *str2;
@@ -908,17 +989,17 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		break;
 	    }
 
-	case _PUSHINT:
+	case _PUSHINT: OP_LABEL(_PUSHINT)
 	    inc_sp();
 	    sp->type = (short) (cdp++)->op;
 	    break;
 
-	case _BUILTIN:
-	case _PRINT:
+	case _BUILTIN: OP_LABEL(_BUILTIN)
+	case _PRINT: OP_LABEL(_PRINT)
 	    sp = (*(cdp++)->fnc) (sp);
 	    break;
 
-	case _POST_INC:
+	case _POST_INC: OP_LABEL(_POST_INC)
 	    cp = (CELL *) sp->ptr;
 	    if (cp->type != C_DOUBLE)
 		cast1_to_d(cp);
@@ -927,7 +1008,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cp->dval += 1.0;
 	    break;
 
-	case _POST_DEC:
+	case _POST_DEC: OP_LABEL(_POST_DEC)
 	    cp = (CELL *) sp->ptr;
 	    if (cp->type != C_DOUBLE)
 		cast1_to_d(cp);
@@ -936,7 +1017,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cp->dval -= 1.0;
 	    break;
 
-	case _PRE_INC:
+	case _PRE_INC: OP_LABEL(_PRE_INC)
 	    cp = (CELL *) sp->ptr;
 	    if (cp->type != C_DOUBLE)
 		cast1_to_d(cp);
@@ -944,7 +1025,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->type = C_DOUBLE;
 	    break;
 
-	case _PRE_DEC:
+	case _PRE_DEC: OP_LABEL(_PRE_DEC)
 	    cp = (CELL *) sp->ptr;
 	    if (cp->type != C_DOUBLE)
 		cast1_to_d(cp);
@@ -952,7 +1033,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->type = C_DOUBLE;
 	    break;
 
-	case F_POST_INC:
+	case F_POST_INC: OP_LABEL(F_POST_INC)
 	    cp = (CELL *) sp->ptr;
 	    cellcpy(&tc, cp);
 	    cast1_to_d(&tc);
@@ -962,7 +1043,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_POST_DEC:
+	case F_POST_DEC: OP_LABEL(F_POST_DEC)
 	    cp = (CELL *) sp->ptr;
 	    cellcpy(&tc, cp);
 	    cast1_to_d(&tc);
@@ -972,25 +1053,25 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    field_assign(cp, &tc);
 	    break;
 
-	case F_PRE_INC:
+	case F_PRE_INC: OP_LABEL(F_PRE_INC)
 	    cp = (CELL *) sp->ptr;
 	    cast1_to_d(cellcpy(sp, cp));
 	    sp->dval += 1.0;
 	    field_assign(cp, sp);
 	    break;
 
-	case F_PRE_DEC:
+	case F_PRE_DEC: OP_LABEL(F_PRE_DEC)
 	    cp = (CELL *) sp->ptr;
 	    cast1_to_d(cellcpy(sp, cp));
 	    sp->dval -= 1.0;
 	    field_assign(cp, sp);
 	    break;
 
-	case _JMP:
+	case _JMP: OP_LABEL(_JMP)
 	    cdp += cdp->op;
 	    break;
 
-	case _JNZ:
+	case _JNZ: OP_LABEL(_JNZ)
 	    /* jmp if top of stack is non-zero and pop stack */
 	    if (test(sp))
 		cdp += cdp->op;
@@ -1000,7 +1081,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    dec_sp();
 	    break;
 
-	case _JZ:
+	case _JZ: OP_LABEL(_JZ)
 	    /* jmp if top of stack is zero and pop stack */
 	    if (!test(sp))
 		cdp += cdp->op;
@@ -1010,7 +1091,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    dec_sp();
 	    break;
 
-	case _LJZ:
+	case _LJZ: OP_LABEL(_LJZ)
 	    /* special jump for logical and */
 	    /* this is always preceded by _TEST */
 	    if (sp->dval == 0.0) {
@@ -1023,7 +1104,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case _LJNZ:
+	case _LJNZ: OP_LABEL(_LJNZ)
 	    /* special jump for logical or */
 	    /* this is always preceded by _TEST */
 	    if (sp->dval != 0.0) {
@@ -1038,49 +1119,49 @@ execute(INST * cdp,		/* code ptr, start execution here */
 
 	    /*  the relation operations */
 	    /*  compare() makes sure string ref counts are OK */
-	case _EQ:
+	case _EQ: OP_LABEL(_EQ)
 	    dec_sp();
 	    t = CompareCells(sp, 1);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t == 0 ? 1.0 : 0.0;
 	    break;
 
-	case _NEQ:
+	case _NEQ: OP_LABEL(_NEQ)
 	    dec_sp();
 	    t = CompareCells(sp, 1);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t ? 1.0 : 0.0;
 	    break;
 
-	case _LT:
+	case _LT: OP_LABEL(_LT)
 	    dec_sp();
 	    t = CompareCells(sp, 0);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t < 0 ? 1.0 : 0.0;
 	    break;
 
-	case _LTE:
+	case _LTE: OP_LABEL(_LTE)
 	    dec_sp();
 	    t = CompareCells(sp, 1);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t <= 0 ? 1.0 : 0.0;
 	    break;
 
-	case _GT:
+	case _GT: OP_LABEL(_GT)
 	    dec_sp();
 	    t = CompareCells(sp, 0);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t > 0 ? 1.0 : 0.0;
 	    break;
 
-	case _GTE:
+	case _GTE: OP_LABEL(_GTE)
 	    dec_sp();
 	    t = CompareCells(sp, -1);
 	    sp->type = C_DOUBLE;
 	    sp->dval = t >= 0 ? 1.0 : 0.0;
 	    break;
 
-	case _MATCH0:
+	case _MATCH0: OP_LABEL(_MATCH0)
 	    /* does $0 match, the RE at cdp? */
 
 	    inc_sp();
@@ -1097,7 +1178,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    cellcpy(sp, field);
 	    /* FALLTHRU */
 
-	case _MATCH1:
+	case _MATCH1: OP_LABEL(_MATCH1)
 	    /* does expr at sp[0] match RE at cdp */
 	    if (sp->type < C_STRING)
 		cast1_to_s(sp);
@@ -1109,7 +1190,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = t ? 1.0 : 0.0;
 	    break;
 
-	case _MATCH2:
+	case _MATCH2: OP_LABEL(_MATCH2)
 	    /* does sp[-1] match sp[0] as re */
 	    cast_to_RE(sp);
 
@@ -1126,7 +1207,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = t ? 1.0 : 0.0;
 	    break;
 
-	case A_TEST:
+	case A_TEST: OP_LABEL(A_TEST)
 	    /* entry :  sp[0].ptr-> an array
 	       sp[-1]  is an expression
 
@@ -1138,7 +1219,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp->dval = (cp != (CELL *) 0) ? 1.0 : 0.0;
 	    break;
 
-	case A_DEL:
+	case A_DEL: OP_LABEL(A_DEL)
 	    /* sp[0].ptr ->  array
 	       sp[-1] is an expr
 	       delete  array[expr]      */
@@ -1148,25 +1229,25 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    sp -= 2;
 	    break;
 
-	case DEL_A:
+	case DEL_A: OP_LABEL(DEL_A)
 	    /* free all the array at once */
 	    array_clear(sp->ptr);
 	    dec_sp();
 	    break;
 
 	    /* form a multiple array index */
-	case A_CAT:
+	case A_CAT: OP_LABEL(A_CAT)
 	    sp = array_cat(sp, (cdp++)->op);
 	    break;
 
-	case _EXIT:
+	case _EXIT: OP_LABEL(_EXIT)
 	    if (sp->type != C_DOUBLE)
 		cast1_to_d(sp);
 	    exit_code = d_to_i(sp->dval);
 	    dec_sp();
 	    /* FALLTHRU */
 
-	case _EXIT0:
+	case _EXIT0: OP_LABEL(_EXIT0)
 
 	    if (!end_start)
 		mawk_exit(exit_code);
@@ -1186,36 +1267,41 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    sp = stack_under;	/* might be in user function */
 	    CLEAR_ALOOP_STACK();	/* ditto */
+	    while (call_depth > frame_base) {
+		/* and so might the loops of its callers */
+		aloop_state = call_stack[--call_depth].aloop_state;
+		CLEAR_ALOOP_STACK();
+	    }
 	    break;
 
-	case _JMAIN:		/* go from BEGIN code to MAIN code */
+	case _JMAIN: OP_LABEL(_JMAIN)		/* go from BEGIN code to MAIN code */
 	    free_codes("BEGIN", begin_start, begin_size);
 	    begin_start = NULL;
 	    begin_size = 0;
 	    cdp = main_start;
 	    break;
 
-	case _OMAIN:
+	case _OMAIN: OP_LABEL(_OMAIN)
 	    if (!main_fin)
 		open_main();
 	    restart_label = cdp;
 	    cdp = next_label;
 	    break;
 
-	case _NEXT:
+	case _NEXT: OP_LABEL(_NEXT)
 	    /* next might be inside an aloop -- clear stack */
 	    CLEAR_ALOOP_STACK();
 	    cdp = next_label;
 	    break;
 
-	case _NEXTFILE:
+	case _NEXTFILE: OP_LABEL(_NEXTFILE)
 	    /* nextfile might be inside an aloop -- clear stack */
 	    CLEAR_ALOOP_STACK();
 	    FINsemi_close(main_fin);
 	    cdp = next_label;
 	    break;
 
-	case OL_GL:
+	case OL_GL: OP_LABEL(OL_GL)
 	    {
 		char *p;
 		size_t len;
@@ -1240,7 +1326,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 
 	    /* two kinds of OL_GL is a historical stupidity from working on
 	       a machine with very slow floating point emulation */
-	case OL_GL_NR:
+	case OL_GL_NR: OP_LABEL(OL_GL_NR)
 	    {
 		char *p;
 		size_t len;
@@ -1269,7 +1355,7 @@ execute(INST * cdp,		/* code ptr, start execution here */
 	    }
 	    break;
 
-	case _RANGE:
+	case _RANGE: OP_LABEL(_RANGE)
 /* test a range pattern:  pat1, pat2 { action }
    entry :
        cdp[0].op -- a flag, test pat1 if on else pat2
@@ -1307,34 +1393,78 @@ execute(INST * cdp,		/* code ptr, start execution here */
 
 /* function calls  */
 
-	case _RET0:
+	case _RET0: OP_LABEL(_RET0)
 	    inc_sp();
 	    sp->type = C_NOINIT;
 	    /* FALLTHRU */
 
-	case _RET:
+	case _RET: OP_LABEL(_RET)
 
 #ifdef	DEBUG
 	    if (sp != entry_sp + 1)
 		bozo("ret");
 #endif
-	    if (old_stack_base)	/* reset stack */
-	    {
-		/* move the return value */
-		cellcpy(old_sp + 1, sp);
-		cell_destroy(sp);
-		zfree(stack_base, sizeof(CELL) * EVAL_STACK_SIZE);
-		stack_base = old_stack_base;
-		stack_danger = old_stack_base + DANGER;
-	    }
-
 	    /* return might be inside an aloop -- clear stack */
 	    CLEAR_ALOOP_STACK();
 
-	    return;
+	    {
+		CALL_FRAME *frame = &call_stack[--call_depth];
+		FBLOCK *fbp = frame->fbp;
+		CELL *nfp = fp;	/* the callee's frame */
+		CELL *local_p = fp + frame->a_args;	/* first local argument */
+		SYM_TYPE *type_p = NULL;	/* pts to type of an argument */
+
+		if (frame->old_stack_base)	/* reset stack */
+		{
+		    /* move the return value */
+		    cellcpy(frame->sp + 1, sp);
+		    cell_destroy(sp);
+		    zfree(stack_base, sizeof(CELL) * EVAL_STACK_SIZE);
+		    stack_base = frame->old_stack_base;
+		    stack_danger = stack_base + DANGER;
+		}
+		sp = frame->sp;
+		cdp = frame->cdp;
+		fp = frame->fp;
+		aloop_state = frame->aloop_state;
+#ifdef	DEBUG
+		entry_sp = frame->entry_sp;
+#endif
+
+		/* cleanup the callee's arguments */
+		/* putting return value at top of eval stack */
+		if (fbp->nargs)
+		    type_p = fbp->typev + fbp->nargs - 1;
+		if ((type_p != NULL) && (sp >= nfp)) {
+		    cp = sp + 1;	/* cp -> the function return */
+
+		    do {
+			if (*type_p == ST_LOCAL_ARRAY) {
+			    if (sp >= local_p) {
+				array_clear(sp->ptr);
+				ZFREE((ARRAY) sp->ptr);
+			    }
+			} else {
+			    cell_destroy(sp);
+			}
+
+			type_p--;
+			dec_sp();
+
+		    }
+		    while (sp >= nfp);
+
+		    inc_sp();
+		    cellcpy(sp, cp);
+		    cell_destroy(cp);
+		} else {
+		    inc_sp();	/* no arguments passed */
+		}
+	    }
+	    break;
 
-	case _CALLX:
-	case _CALL:
+	case _CALLX: OP_LABEL(_CALLX)
+	case _CALL: OP_LABEL(_CALL)
 
 	    /*  cdp[0] holds ptr to "function block"
 	       cdp[1] holds number of input arguments
@@ -1344,8 +1474,35 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		FBLOCK *fbp = (FBLOCK *) (cdp++)->ptr;
 		int a_args = (cdp++)->op;	/* actual number of args */
 		CELL *nfp = sp - a_args + 1;	/* new fp for callee */
-		CELL *local_p = sp + 1;		/* first local argument on stack */
 		SYM_TYPE *type_p = NULL;	/* pts to type of an argument */
+		CALL_FRAME *frame;
+
+		if (cdp->op == _RET
+		    && call_depth > frame_base
+		    && can_tail_call(frame = &call_stack[call_depth - 1], nfp)) {
+		    /* return f(...), replace the returning function's
+		       arguments by those of f, and keep its return */
+		    CLEAR_ALOOP_STACK();
+		    for (t = 0; t < (int) frame->fbp->nargs; ++t) {
+			if (frame->fbp->typev[t] != ST_LOCAL_ARRAY)
+			    cell_destroy(fp + t);
+		    }
+		    if (a_args)
+			memmove(fp, nfp, (size_t) a_args * sizeof(CELL));
+		    sp = fp + a_args - 1;
+		    nfp = fp;
+		} else {
+		    frame = push_call_frame();
+		    frame->cdp = cdp;
+		    frame->fp = fp;
+		    frame->aloop_state = aloop_state;
+#ifdef	DEBUG
+		    frame->entry_sp = entry_sp;
+#endif
+		    aloop_state = (ALOOP_STATE *) 0;
+		}
+		frame->fbp = fbp;
+		frame->a_args = a_args;
 
 		if (fbp->nargs) {
 		    type_p = fbp->typev + a_args - 1;
@@ -1364,44 +1521,372 @@ execute(INST * cdp,		/* code ptr, start execution here */
 		    }
 		}
 
-		execute(fbp->code, sp, nfp);
+		frame->sp = sp;
+		frame->old_stack_base = (CELL *) 0;
+		if (sp > stack_danger) {	/* change stacks */
+		    frame->old_stack_base = stack_base;
+		    stack_base = (CELL *) zmalloc(sizeof(CELL) * EVAL_STACK_SIZE);
+		    stack_danger = stack_base + DANGER;
+		    sp = stack_base;
+		    /* waste 1 slot for ANSI, actually large model msdos breaks in
+		       RET if we don't */
+		}
+#ifdef	DEBUG
+		entry_sp = sp;
+#endif
+		fp = nfp;
+		cdp = fbp->code;
+	    }
+	    break;
 
-		/* cleanup the callee's arguments */
-		/* putting return value at top of eval stack */
-		if ((type_p != NULL) && (sp >= nfp)) {
-		    cp = sp + 1;	/* cp -> the function return */
+	case _ICALL: OP_LABEL(_ICALL)
+	    /*  the body of a function follows, see code_inline()
+	       cdp[0] holds its size, cdp[1] ptr to "function block",
+	       cdp[2] the number of input arguments
+	     */
+	    {
+		FBLOCK *fbp = (FBLOCK *) cdp[1].ptr;
 
-		    do {
-			if (*type_p == ST_LOCAL_ARRAY) {
-			    if (sp >= local_p) {
-				array_clear(sp->ptr);
-				ZFREE((ARRAY) sp->ptr);
-			    }
-			} else {
-			    cell_destroy(sp);
-			}
+		for (t = fbp->nargs - cdp[2].op; t > 0; t--) {
+		    inc_sp();
+		    sp->type = C_NOINIT;
+		}
+		inline_fp = fp;
+		fp = sp - fbp->nargs + 1;
+		cdp += 3;
+	    }
+	    break;
 
-			type_p--;
-			dec_sp();
+	case _IRET: OP_LABEL(_IRET)
+	    /* the return value replaces the arguments and locals,
+	       then jump past the inlined body */
+	    if (sp != fp) {
+		for (cp = fp; cp < sp; cp++)
+		    cell_destroy(cp);
+		*fp = *sp;
+		sp = fp;
+	    }
+	    fp = inline_fp;
+	    cdp += cdp->op;
+	    break;
 
-		    }
-		    while (sp >= nfp);
+	    /* superinstructions, see code_fuse() */
+	case _JCMP_I: OP_LABEL(_JCMP_I)
+	    /* _PUSHI, a relational operator, then _JZ or _JNZ */
+	    cp = (CELL *) cdp->ptr;
+	    if (cp->type == C_STRING && sp->type == C_STRING) {
+		/* borrow the variable's STRING rather than copying it */
+		t = test_order(compare_strings(string(sp), string(cp)),
+			       cdp[1].op);
+		free_STRING(string(sp));
+		dec_sp();
+		goto jcmp_jump;
+	    }
+	    inc_sp();
+	    cellcpy(sp, cp);
+	    dec_sp();
+	    goto jcmp;
+
+	case _JCMP_D: OP_LABEL(_JCMP_D)
+	    /* _PUSHD, a relational operator, then _JZ or _JNZ */
+	    sp[1].type = C_DOUBLE;
+	    sp[1].dval = *(double *) cdp->ptr;
+	  jcmp:
+	    t = compare_op(sp, cdp[1].op);
+	    dec_sp();
+	  jcmp_jump:
+	    cdp += 2;
+	    if ((cdp++)->op == _JZ ? !t : t)
+		cdp += cdp->op;
+	    else
+		cdp++;
+	    break;
 
-		    inc_sp();
-		    cellcpy(sp, cp);
-		    cell_destroy(cp);
-		} else {
-		    inc_sp();	/* no arguments passed */
-		}
+	case _ARITH_I: OP_LABEL(_ARITH_I)
+	    /* _PUSHI then _ADD, _SUB, _MUL or _DIV */
+	    cp = (CELL *) (cdp++)->ptr;
+	    if (cp->type == C_DOUBLE || cp->type == C_STRNUM) {
+		/* read the number in place, leaving any STRING alone */
+		tc.dval = cp->dval;
+	    } else {
+		cellcpy(&tc, cp);
+		cast1_to_d(&tc);
+	    }
+	    goto arith;
+
+	case _ARITH_D: OP_LABEL(_ARITH_D)
+	    /* _PUSHD then _ADD, _SUB, _MUL or _DIV */
+	    tc.dval = *(double *) (cdp++)->ptr;
+	  arith:
+	    if (sp->type != C_DOUBLE)
+		cast1_to_d(sp);
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    switch ((cdp++)->op) {
+	    case _ADD:
+		sp->dval += tc.dval;
+		break;
+	    case _SUB:
+		sp->dval -= tc.dval;
+		break;
+	    case _MUL:
+		sp->dval *= tc.dval;
+		break;
+	    default:		/* _DIV */
+#ifdef  NOINFO_SIGFPE
+		CHECK_DIVZERO(tc.dval);
+#endif
+		sp->dval /= tc.dval;
+		break;
+	    }
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    break;
+
+	case AE_INCDEC: OP_LABEL(AE_INCDEC)
+	    /* AE_PUSHA, an increment or decrement, then _POP */
+	    {
+		ARRAY A = (ARRAY) (cdp++)->ptr;
+		double delta = ((cdp->op == _POST_INC || cdp->op == _PRE_INC)
+				? 1.0
+				: -1.0);
+
+		array_incdec(A, sp, delta);
+		cell_destroy(sp);
+		dec_sp();
+		cdp += 2;
 	    }
 	    break;
 
+	case AE_INCDEC_V: OP_LABEL(AE_INCDEC_V)
+	    /* AE_PUSHA and an increment or decrement, keeping the value */
+	    {
+		ARRAY A = (ARRAY) (cdp++)->ptr;
+		double delta = ((cdp->op == _POST_INC || cdp->op == _PRE_INC)
+				? 1.0
+				: -1.0);
+		double d = array_incdec(A, sp, delta);
+
+		cell_destroy(sp);
+		sp->type = C_DOUBLE;
+		sp->dval = ((cdp->op == _POST_INC || cdp->op == _POST_DEC)
+			    ? d
+			    : d + delta);
+		cdp++;
+	    }
+	    break;
+
+	case _INCDEC: OP_LABEL(_INCDEC)
+	    /* _PUSHA, an increment or decrement, then _POP */
+	    cp = (CELL *) (cdp++)->ptr;
+	    if (cp->type != C_DOUBLE)
+		cast1_to_d(cp);
+	    if (cdp->op == _POST_INC || cdp->op == _PRE_INC)
+		cp->dval += 1.0;
+	    else
+		cp->dval -= 1.0;
+	    cdp += 2;
+	    break;
+
+	case _ASSIGN_POP: OP_LABEL(_ASSIGN_POP)
+	    /* _ASSIGN, without keeping the result */
+	    if (sp->type == C_MBSTRN)
+		check_strnum(sp);
+	    cp = (CELL *) (sp - 1)->ptr;
+	    cell_destroy(cp);
+	    cellcpy(cp, sp);
+	    cell_destroy(sp);
+	    sp -= 2;
+	    cdp++;
+	    break;
+
+	case _ADD_ASG_POP: OP_LABEL(_ADD_ASG_POP)
+	    /* _ADD_ASG, without keeping the result */
+	    if (sp->type != C_DOUBLE)
+		cast1_to_d(sp);
+	    cp = (CELL *) (sp - 1)->ptr;
+	    if (cp->type != C_DOUBLE)
+		cast1_to_d(cp);
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    cp->dval += sp->dval;
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    sp -= 2;
+	    cdp++;
+	    break;
+
+	    /* the operators on two numbers, see code_specialize() */
+	case D_ADD: OP_LABEL(D_ADD)
+	    dec_sp();
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    sp[0].dval += sp[1].dval;
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_SUB: OP_LABEL(D_SUB)
+	    dec_sp();
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    sp[0].dval -= sp[1].dval;
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_MUL: OP_LABEL(D_MUL)
+	    dec_sp();
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    sp[0].dval *= sp[1].dval;
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_DIV: OP_LABEL(D_DIV)
+	    dec_sp();
+#ifdef  NOINFO_SIGFPE
+	    CHECK_DIVZERO(sp[1].dval);
+#endif
+#ifdef SW_FP_CHECK
+	    clrerr();
+#endif
+	    sp[0].dval /= sp[1].dval;
+#ifdef SW_FP_CHECK
+	    fpcheck();
+#endif
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_MOD: OP_LABEL(D_MOD)
+	    dec_sp();
+#ifdef  NOINFO_SIGFPE
+	    CHECK_DIVZERO(sp[1].dval);
+#endif
+	    sp[0].dval = fmod(sp[0].dval, sp[1].dval);
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_POW: OP_LABEL(D_POW)
+	    dec_sp();
+	    sp[0].dval = pow(sp[0].dval, sp[1].dval);
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_EQ: OP_LABEL(D_EQ)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, 1) == 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_NEQ: OP_LABEL(D_NEQ)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, 1) != 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_LT: OP_LABEL(D_LT)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, 0) < 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_LTE: OP_LABEL(D_LTE)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, 1) <= 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_GT: OP_LABEL(D_GT)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, 0) > 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
+	case D_GTE: OP_LABEL(D_GTE)
+	    dec_sp();
+	    sp->dval = CompareDoubles(sp, -1) >= 0 ? 1.0 : 0.0;
+	    sp->type = C_DOUBLE;
+	    break;
+
 	default:
 	    bozo("bad opcode");
 	}
     }
 }
 
+/*
+ * Test the result of a three-way comparison for the relational operator 'op',
+ * one of _EQ ... _GTE.
+ */
+static int
+test_order(int result, int op)
+{
+    switch (op) {
+    case _EQ:
+	return result == 0;
+    case _NEQ:
+	return result != 0;
+    case _LT:
+	return result < 0;
+    case _LTE:
+	return result <= 0;
+    case _GT:
+	return result > 0;
+    default:			/* _GTE */
+	return result >= 0;
+    }
+}
+
+/*
+ * Compare sp[0] and sp[1] for the relational operator 'op', as the _EQ ...
+ * _GTE and D_EQ ... D_GTE handlers do, returning 1 if the relation holds.
+ */
+static int
+compare_op(CELL *sp, int op)
+{
+    switch (op) {
+    case _EQ:
+	return CompareCells(sp, 1) == 0;
+    case _NEQ:
+	return CompareCells(sp, 1) != 0;
+    case _LT:
+	return CompareCells(sp, 0) < 0;
+    case _LTE:
+	return CompareCells(sp, 1) <= 0;
+    case _GT:
+	return CompareCells(sp, 0) > 0;
+    case _GTE:
+	return CompareCells(sp, -1) >= 0;
+    case D_EQ:
+	return CompareDoubles(sp, 1) == 0;
+    case D_NEQ:
+	return CompareDoubles(sp, 1) != 0;
+    case D_LT:
+	return CompareDoubles(sp, 0) < 0;
+    case D_LTE:
+	return CompareDoubles(sp, 1) <= 0;
+    case D_GT:
+	return CompareDoubles(sp, 0) > 0;
+    default:			/* D_GTE */
+	return CompareDoubles(sp, -1) >= 0;
+    }
+}
+
 /*
   return 0 if a numeric is zero else return non-zero
   return 0 if a string is "" else return non-zero
@@ -1428,6 +1913,41 @@ test(CELL *cp)
     return 0;			/*can't get here: shutup */
 }
 
+/* compare the doubles at cp and cp+1 */
+static int
+CompareDoubles(CELL *cp, int eq)
+{
+#if defined(HAVE_ISNAN)
+    if (posix_space_flag && (isnan(cp->dval) || isnan((cp + 1)->dval)))
+	return eq;
+#endif
+    return ((cp->dval > (cp + 1)->dval)
+	    ? 1
+	    : ((cp->dval < (cp + 1)->dval)
+	       ? -1
+	       : 0));
+}
+
+/* compare two STRINGs bytewise, the shorter first on a tie */
+int
+compare_strings(STRING * s1, STRING * s2)
+{
+    size_t len = s1->len;
+    int result;
+
+    if (len > s2->len)
+	len = s2->len;
+    result = memcmp(s1->str, s2->str, len);
+    if (result == 0) {
+	if (len != s1->len) {
+	    result = 1;
+	} else if (len != s2->len) {
+	    result = -1;
+	}
+    }
+    return result;
+}
+
 /* compare cells at cp and cp+1 and
    frees STRINGs at those cells
 */
@@ -1435,7 +1955,6 @@ static int
 CompareCells(CELL *cp, int eq)
 {
     int result;
-    size_t len;
 
   reswitch:
     result = 0;
@@ -1446,33 +1965,13 @@ CompareCells(CELL *cp, int eq)
 
     case TWO_DOUBLES:
       two_d:
-#if defined(HAVE_ISNAN)
-	if (posix_space_flag && (isnan(cp->dval) || isnan((cp + 1)->dval))) {
-	    result = eq;
-	    break;
-	}
-#endif
-	result = ((cp->dval > (cp + 1)->dval)
-		  ? 1
-		  : ((cp->dval < (cp + 1)->dval)
-		     ? -1
-		     : 0));
+	result = CompareDoubles(cp, eq);
 	break;
 
     case TWO_STRINGS:
     case STRING_AND_STRNUM:
       two_s:
-	len = string(cp)->len;
-	if (len > string(cp + 1)->len)
-	    len = string(cp + 1)->len;
-	result = memcmp(string(cp)->str, string(cp + 1)->str, len);
-	if (result == 0) {
-	    if (len != string(cp)->len) {
-		result = 1;
-	    } else if (len != string(cp + 1)->len) {
-		result = -1;
-	    }
-	}
+	result = compare_strings(string(cp), string(cp + 1));
 	free_STRING(string(cp));
 	free_STRING(string(cp + 1));
 	break;
@@ -1513,11 +2012,11 @@ CELL *
 cellcpy(CELL *target, CELL *source)
 {
     switch (target->type = source->type) {
-    case C_NOINIT:
     case C_SPACE:
     case C_SNULL:
 	break;
 
+    case C_NOINIT:		/* dval is zero, see code_specialize() */
     case C_DOUBLE:
 	target->dval = source->dval;
 	break;
@@ -1546,6 +2045,38 @@ cellcpy(CELL *target, CELL *source)
     return target;
 }
 
+/*
+ * Pass each eval stack, all of it, to fn, so that array.c can see which
+ * elements are referenced by cells which an expression has yet to use.
+ */
+void
+eval_stacks(void (*fn) (CELL *, size_t))
+{
+    size_t i;
+
+    fn(eval_stack, EVAL_STACK_SIZE);
+    if (stack_base != eval_stack)
+	fn(stack_base, EVAL_STACK_SIZE);
+    for (i = 0; i < call_depth; i++) {
+	CELL *base = call_stack[i].old_stack_base;
+	if (base != NULL && base != eval_stack)
+	    fn(base, EVAL_STACK_SIZE);
+    }
+}
+
+#ifdef NO_LEAKS
+void
+execute_leaks(void)
+{
+    TRACE(("execute_leaks\n"));
+    if (call_stack != NULL) {
+	zfree(call_stack, call_limit * sizeof(CALL_FRAME));
+	call_stack = NULL;
+	call_limit = call_depth = 0;
+    }
+}
+#endif
+
 #ifdef	 DEBUG
 
 void
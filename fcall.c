@@ -126,6 +126,20 @@ inst_len(INST * p)
 	case _JMAIN:
 	case OL_GL:
 	case OL_GL_NR:
+	case _ASSIGN_POP:
+	case _ADD_ASG_POP:
+	case D_ADD:
+	case D_SUB:
+	case D_MUL:
+	case D_DIV:
+	case D_MOD:
+	case D_POW:
+	case D_EQ:
+	case D_NEQ:
+	case D_LT:
+	case D_LTE:
+	case D_GT:
+	case D_GTE:
 	    /* simple_codes */
 	    break;
 	case L_PUSHA:
@@ -156,6 +170,14 @@ inst_len(INST * p)
 	case SET_ALOOP:
 	case ALOOP:
 	case A_CAT:
+	case _JCMP_D:
+	case _JCMP_I:
+	case _ARITH_D:
+	case _ARITH_I:
+	case _INCDEC:
+	case AE_INCDEC:
+	case AE_INCDEC_V:
+	case _IRET:
 	    ++result;
 	    break;
 	case A_LENGTH:
@@ -166,6 +188,9 @@ inst_len(INST * p)
 	case _CALL:
 	    result += 2;
 	    break;
+	case _ICALL:
+	    result += 3;
+	    break;
 	case _RANGE:
 	    result += 4;
 	    break;
@@ -553,7 +553,7 @@ build_field0(void)
 
 		    ival = d_to_L(cp->dval);
 		    if (ival == cp->dval)
-			sprintf(xbuff, LONG_FMT, ival);
+			L_to_str(ival, xbuff);
 		    else
 			sprintf(xbuff, string(CONVFMT)->str, cp->dval);
 
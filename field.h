@@ -26,6 +26,7 @@ extern void set_field0(const char *, size_t);
 extern void split_field0(void);
 extern void field_assign(CELL *, CELL *);
 extern char *is_string_split(PTR, size_t *);
+extern char *is_string_match(PTR, size_t *);
 extern void slow_cell_assign(CELL *, CELL *);
 extern CELL *slow_field_ptr(int);
 extern int field_addr_to_index(const CELL *);
@@ -27,6 +27,7 @@ the GNU General Public License, version 2, 1991.
 #include <field.h>
 #include <symtype.h>
 #include <scan.h>
+#include <code.h>
 
 #ifdef	  HAVE_FCNTL_H
 #include <fcntl.h>
@@ -601,6 +602,7 @@ is_cmdline_assign(char *s)
     case ST_NR:		/* !! no one will do this */
 	cp = stp->stval.cp;
 	cell_destroy(cp);
+	code_unspecialize(cp);
 	break;
 
     case ST_FIELD:
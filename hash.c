@@ -44,19 +44,83 @@ hash(const char *s)
     return h;
 }
 
+/*
+ * Array keys use a word-at-a-time hash (the xxHash32 construction), which
+ * mixes every input bit into the low bits used to index a table.  The seed
+ * is zero unless MAWK_HASH_SEED says otherwise.
+ */
+#define PRIME32_1 2654435761U
+#define PRIME32_2 2246822519U
+#define PRIME32_3 3266489917U
+#define PRIME32_4 668265263U
+#define PRIME32_5 374761393U
+
+#define rotl32(x,r) (((x) << (r)) | ((x) >> (32 - (r))))
+
+#define read32(p) ((unsigned) (p)[0] \
+		   | ((unsigned) (p)[1] << 8) \
+		   | ((unsigned) (p)[2] << 16) \
+		   | ((unsigned) (p)[3] << 24))
+
+#define round32(v,p) rotl32((v) + read32(p) * PRIME32_2, 13) * PRIME32_1
+
+unsigned hash_seed;
+
 unsigned
 hash2(const char *s, size_t len)
 {
-    /* FNV-1 */
-    register unsigned h = 2166136261U;
+    const UChar *p = (const UChar *) s;
+    const UChar *limit = p + len;
+    register unsigned h;
 
-    while (len-- != 0) {
-	h ^= (UChar) (*s++);
-	h *= 16777619U;
+    if (len >= 16) {
+	unsigned v1 = hash_seed + PRIME32_1 + PRIME32_2;
+	unsigned v2 = hash_seed + PRIME32_2;
+	unsigned v3 = hash_seed;
+	unsigned v4 = hash_seed - PRIME32_1;
+
+	do {
+	    v1 = round32(v1, p);
+	    v2 = round32(v2, p + 4);
+	    v3 = round32(v3, p + 8);
+	    v4 = round32(v4, p + 12);
+	    p += 16;
+	} while (limit - p >= 16);
+	h = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+    } else {
+	h = hash_seed + PRIME32_5;
+    }
+    h += (unsigned) len;
+
+    while (limit - p >= 4) {
+	h += read32(p) * PRIME32_3;
+	h = rotl32(h, 17) * PRIME32_4;
+	p += 4;
+    }
+    while (p < limit) {
+	h += (*p++) * PRIME32_5;
+	h = rotl32(h, 11) * PRIME32_1;
     }
+
+    h ^= h >> 15;
+    h *= PRIME32_2;
+    h ^= h >> 13;
+    h *= PRIME32_3;
+    h ^= h >> 16;
     return h;
 }
 
+/* hash2() of a STRING, remembered in the STRING */
+unsigned
+string_hash(STRING * sval)
+{
+    unsigned h = hash2(sval->str, sval->len);
+
+    if (h == 0)			/* zero means not yet computed */
+	h = 1;
+    return (sval->hval = h);
+}
+
 typedef struct hash {
     struct hash *link;
     SYMTAB symtab;
@@ -265,6 +329,19 @@ reverse_find(int type, PTR ptr)
     return uk;
 }
 
+/* call f for each entry of the symbol table */
+void
+hash_walk(void (*f) (SYMTAB *))
+{
+    int i;
+    HASHNODE *p;
+
+    for (i = 0; i < HASH_PRIME; i++) {
+	for (p = hash_table[i]; p != NULL; p = p->link)
+	    f(&p->symtab);
+    }
+}
+
 #ifdef NO_LEAKS
 static void
 free_symtab_name(HASHNODE * p)
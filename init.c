@@ -39,14 +39,18 @@ typedef enum {
 #if USE_BINMODE
     W_BINMODE,
 #endif
+    W_CASEFOLD,
     W_DUMP,
     W_EXEC,
     W_HELP,
     W_INTERACTIVE,
+    W_ORDER,
     W_POSIX,
     W_RANDOM,
     W_RE_INTERVAL,
+    W_SPILL,
     W_SPRINTF,
+    W_STATS,
     W_TRADITIONAL,
     W_USAGE,
     W__IGNORE
@@ -60,6 +64,8 @@ extern void reargv(int *, char ***);
 
 const char *progname;
 short interactive_flag = 0;
+short casefold_flag = 0;	/* -Wcasefold */
+short stats_flag = 0;		/* -Wstats */
 
 #ifndef	 SET_PROGNAME
 #define	 SET_PROGNAME() \
@@ -92,14 +98,18 @@ static const struct {
 #if USE_BINMODE
     { W_BINMODE,     0, 0, "binmode" },
 #endif
+    { W_CASEFOLD,    0, 0, "casefold" },
     { W_DUMP,        0, 0, "dump" },
     { W_EXEC,        1, 1, "exec" },
     { W_HELP,        1, 0, "help" },
     { W_INTERACTIVE, 0, 0, "interactive" },
+    { W_ORDER,       0, 1, "order" },
     { W_POSIX,       1, 0, "posix" },
     { W_RANDOM,      0, 1, "random" },
     { W_RE_INTERVAL, 2, 0, "re-interval" },
     { W_SPRINTF,     0, 1, "sprintf" },
+    { W_STATS,       0, 0, "stats" },
+    { W_SPILL,       0, 1, "spill" },	/* after sprintf, for -Ws */
     { W_TRADITIONAL, 1, 0, "traditional" },
     { W_USAGE,       0, 0, "usage" },
     { W__IGNORE,     2, 0, "lint" },
@@ -140,13 +150,18 @@ usage(FILE *fp)
 #if USE_BINMODE
 	"    -W binmode",
 #endif
+	"    -W casefold      ignore case when matching regular expressions.",
 	"    -W dump          show assembler-like listing of program and exit.",
 	"    -W help          show this message and exit.",
 	"    -W interactive   set unbuffered output, line-buffered input.",
 	"    -W exec file     use file as program as well as last option.",
+	"    -W order=how     visit array indices in order, e.g., ind_str_asc.",
 	"    -W posix         stricter POSIX checking.",
 	"    -W random=number set initial random seed.",
+	"    -W spill=name[:n] keep n elements of array name in memory, the rest",
+	"                     in temporary files.",
 	"    -W sprintf=number adjust size of sprintf buffer.",
+	"    -W stats         report the memory used by arrays at exit.",
 	"    -W traditional   pre-POSIX 2001.",
 	"    -W usage         show this message and exit.",
     };
@@ -314,6 +329,57 @@ numeric_option(const char *source)
     return result;
 }
 
+#define SPILL_LIMIT 1000000	/* elements kept in memory by default */
+
+/*
+ * -W spill=name[:n] makes the global array name keep at most n elements in
+ * memory, writing the rest to temporary files.
+ */
+static void
+spill_option(char *value)
+{
+    char *limit = skipValue(value);
+    char *colon = memchr(value, ':', (size_t) (limit - value));
+    char *name;
+    size_t length = (size_t) ((colon ? colon : limit) - value);
+    size_t n;
+    long cnt = SPILL_LIMIT;
+    SYMTAB *stp;
+
+    for (n = 0; n < length; n++) {
+	if (!(isalpha((UChar) value[n]) || value[n] == '_'
+	      || (n != 0 && isdigit((UChar) value[n]))))
+	    break;
+    }
+    if (length == 0 || n != length) {
+	errmsg(0, "invalid array name for -W spill \"%.*s\"",
+	       (int) length, value);
+	mawk_exit(2);
+    }
+    if (colon != NULL && (cnt = numeric_option(colon + 1)) <= 0) {
+	errmsg(0, "invalid numeric option: \"%s\"", colon + 1);
+	mawk_exit(2);
+    }
+    name = (char *) zmalloc(length + 1);
+    memcpy(name, value, length);
+    name[length] = '\0';
+    stp = find(name);
+    switch (stp->type) {
+    case ST_NONE:
+	stp->type = ST_ARRAY;
+	stp->stval.array = new_ARRAY();
+	no_leaks_array(stp->stval.array);
+	break;
+    case ST_ARRAY:
+	break;
+    default:
+	errmsg(0, "-W spill: %s is not an array", name);
+	mawk_exit(2);
+    }
+    zfree(name, length + 1);
+    array_spill(stp->stval.array, (size_t) cnt);
+}
+
 /*
  * mawk allows the -W option to have multiple parts, separated by commas.  It
  * does that, to allow multiple -W options in a "sharpbang" line.
@@ -372,6 +438,10 @@ handle_w_opt(W_OPTIONS code, int glue, char *option, char **value)
 	posix_space_flag = 0;
 	break;
 
+    case W_CASEFOLD:
+	casefold_flag = 1;
+	break;
+
     case W_DUMP:
 	dump_code_flag = 1;
 	break;
@@ -396,6 +466,19 @@ handle_w_opt(W_OPTIONS code, int glue, char *option, char **value)
 	setbuf(stdout, (char *) 0);
 	break;
 
+    case W_ORDER:
+	wantArg = 1;
+	if (optNext != NULL) {
+	    size_t length = (size_t) (skipValue(optNext) - optNext);
+
+	    if ((array_loop_order = array_sort_order(optNext, length)) < 0) {
+		errmsg(0, "unknown order for -W \"%.*s\"", (int) length, optNext);
+		mawk_exit(2);
+	    }
+	    wantArg = 2;
+	}
+	break;
+
     case W_POSIX:
 	posix_space_flag = 1;
 	break;
@@ -421,6 +504,14 @@ handle_w_opt(W_OPTIONS code, int glue, char *option, char **value)
 	break;
 #endif
 
+    case W_SPILL:
+	wantArg = 1;
+	if (optNext != NULL) {
+	    spill_option(optNext);
+	    wantArg = 2;
+	}
+	break;
+
     case W_SPRINTF:
 	wantArg = 1;
 	if (optNext != NULL) {
@@ -439,6 +530,10 @@ handle_w_opt(W_OPTIONS code, int glue, char *option, char **value)
 	}
 	break;
 
+    case W_STATS:
+	stats_flag = 1;
+	break;
+
     case W_HELP:
 	/* FALLTHRU */
     case W_USAGE:
@@ -761,6 +856,17 @@ initialize(int argc, char **argv)
     kw_init();			/* load the keywords */
     field_init();
 
+    {
+	char *p = getenv("MAWK_HASH_SEED");
+
+	if (p != NULL) {
+	    if (strcmp(p, "random") == 0)
+		hash_seed = (unsigned) fmod(initial_seed(), (double) MAX_UNSIGNED);
+	    else
+		hash_seed = (unsigned) strtoul(p, (char **) 0, 0);
+	}
+    }
+
 #if USE_BINMODE
     {
 	char *p = getenv("MAWKBINMODE");
@@ -794,6 +900,7 @@ array_leaks(void)
 {
     while (all_arrays != NULL) {
 	ALL_ARRAYS *next = all_arrays->next;
+	array_spill(all_arrays->a, 0);
 	array_clear(all_arrays->a);
 	ZFREE(all_arrays->a);
 	free(all_arrays);
@@ -21,8 +21,10 @@ the GNU General Public License, version 2, 1991.
    on the stacks
 */
 
+#define Visible_CA_REC
 #define Visible_CELL
 #define Visible_CODEBLOCK
+#define Visible_FCALL_REC
 
 #include <mawk.h>
 #include <symtype.h>
@@ -248,3 +250,37 @@ code_pop(INST * target)
     code_move_level--;
     return len;
 }
+
+/* The parser wants to throw away the code from start to code_ptr,
+   because it can never be executed.  That is only safe if nothing
+   still refers to it: a jump or break/continue waiting for its target,
+   or the arguments of a function call waiting to be type checked.
+*/
+int
+code_discardable(const INST * start, int scope, const FBLOCK * fbp)
+{
+    int offset = (int) (start - code_base);
+    const JMP *jp;
+    const BC *bp;
+    const FCALL_REC *fp;
+
+    if (error_state)
+	return 0;
+
+    for (jp = jmp_top; jp; jp = jp->link) {
+	if (jp->source_offset >= offset)
+	    return 0;
+    }
+    for (bp = bc_top; bp; bp = bp->link) {
+	if (bp->type && bp->source_offset >= offset)
+	    return 0;
+    }
+    for (fp = resolve_list; fp; fp = fp->link) {
+	if (fp->call_scope == scope &&
+	    (scope == SCOPE_FUNCT ? fbp == fp->call : 1) &&
+	    fp->arg_list &&
+	    fp->arg_list->call_offset >= offset)
+	    return 0;
+    }
+    return 1;
+}
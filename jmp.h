@@ -27,6 +27,7 @@ void code_push(INST *, unsigned, int, FBLOCK *);
 unsigned code_pop(INST *);
 void code_jmp(int, const INST *);
 void patch_jmp(const INST *);
+int code_discardable(const INST *, int, const FBLOCK *);
 
 extern int code_move_level;
    /* used to as one part of unique identification of context when
@@ -30,6 +30,8 @@ keywords[] =
 {
     { "BEGIN",    BEGIN },
     { "END",      END },
+    { "asort",    ASORT },
+    { "asorti",   ASORTI },
     { "break",    BREAK },
     { "continue", CONTINUE },
     { "delete",   DELETE },
@@ -77,6 +77,8 @@ void
 mawk_exit(int x)
 {
     TRACE(("mawk_exit(%d)\n", x));
+    if (stats_flag)
+	array_stats();		/* before stderr is closed */
 #ifdef  HAVE_REAL_PIPES
     close_out_pipes();		/* actually closes all output */
 #else
@@ -87,6 +89,7 @@ mawk_exit(int x)
 
 #ifdef NO_LEAKS
     code_leaks();
+    execute_leaks();
     scan_leaks();
     cell_leaks();
     re_leaks();
@@ -71,6 +71,8 @@ extern int dump_RE;
 #define USE_BINMODE 0
 #endif
 
+extern short casefold_flag;
+extern short stats_flag;
 extern short interactive_flag;
 extern short posix_space_flag;
 extern short traditional_flag;
@@ -152,6 +154,7 @@ extern void cast_to_REPL(CELL *);
 extern Int d_to_I(double);
 extern Long d_to_L(double);
 extern ULong d_to_UL(double d);
+extern size_t L_to_str(Long, char *);
 
 #define NonNull(s)    ((s) == NULL ? "<null>" : (s))
 
@@ -162,6 +165,7 @@ extern ULong d_to_UL(double d);
 #define PastBound(n)  ((n) > UNSIGNED_LIMITS)
 
 extern int test(CELL *);	/* test for null non-null */
+extern int compare_strings(STRING *, STRING *);
 extern CELL *cellcpy(CELL *, CELL *);
 extern CELL *repl_cpy(CELL *, CELL *);
 extern void DB_cell_destroy(CELL *);
@@ -268,6 +272,7 @@ extern void array_leaks(void);
 extern void bi_vars_leaks(void);
 extern void cell_leaks(void);
 extern void code_leaks(void);
+extern void execute_leaks(void);
 extern void field_leaks(void);
 extern void files_leaks(void);
 extern void fin_leaks(void);
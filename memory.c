@@ -20,7 +20,7 @@ the GNU General Public License, version 2, 1991.
 #include <memory.h>
 
 STRING null_str =
-{0, 1, ""};
+{0, 1, 0, ""};
 
 static STRING *
 xnew_STRING(size_t len)
@@ -29,6 +29,7 @@ xnew_STRING(size_t len)
 
     sval->len = len;
     sval->ref_cnt = 1;
+    sval->hval = 0;
     return sval;
 }
 
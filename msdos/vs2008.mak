@@ -26,7 +26,7 @@ OBJ1 =	parse.obj array.obj bi_funct.obj bi_vars.obj cast.obj code.obj \
 OBJ2 =	field.obj files.obj fin.obj hash.obj jmp.obj init.obj \
 	kw.obj main.obj matherr.obj
 
-OBJ3 =	memory.obj print.obj re_cmpl.obj scan.obj scancode.obj split.obj \
+OBJ3 =	memory.obj print.obj re_cmpl.obj scan.obj scancode.obj spill.obj split.obj \
 	zmalloc.obj version.obj regexp.obj dosexec.obj
 
 MAWK_OBJ = $(OBJ1) $(OBJ2) $(OBJ3)
@@ -87,7 +87,7 @@ distclean : clean
 	-del config.h
 
 #  dependencies of .objs on .h
-array.o : symtype.h split.h sizes.h mawk.h config.h types.h nstd.h bi_vars.h zmalloc.h memory.h field.h
+array.o : symtype.h split.h spill.h sizes.h mawk.h config.h types.h nstd.h bi_vars.h zmalloc.h memory.h field.h
 bi_vars.o : symtype.h sizes.h mawk.h config.h types.h init.h nstd.h bi_vars.h zmalloc.h memory.h field.h
 cast.o : scancode.h parse.h symtype.h sizes.h mawk.h config.h types.h nstd.h repl.h zmalloc.h scan.h memory.h field.h
 code.o : scancode.h parse.h symtype.h sizes.h mawk.h config.h types.h init.h nstd.h repl.h jmp.h zmalloc.h scan.h code.h memory.h field.h
@@ -117,6 +117,7 @@ rexp4.o : sizes.h mawk.h config.h types.h rexp.h nstd.h field.h
 rexpdb.o : sizes.h config.h types.h rexp.h nstd.h
 scan.o : scancode.h symtype.h parse.h sizes.h mawk.h config.h types.h fin.h init.h nstd.h repl.h zmalloc.h scan.h code.h files.h memory.h field.h
 scancode.o : scancode.h
+spill.o : sizes.h mawk.h config.h types.h nstd.h array.h spill.h zmalloc.h memory.h
 split.o : scancode.h parse.h symtype.h split.h sizes.h mawk.h config.h types.h regexp.h nstd.h repl.h bi_vars.h zmalloc.h scan.h bi_funct.h memory.h field.h
 version.o : symtype.h sizes.h mawk.h config.h types.h init.h nstd.h patchlev.h
 zmalloc.o : sizes.h mawk.h config.h types.h nstd.h zmalloc.h
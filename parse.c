@@ -32,6 +32,7 @@
 #define Visible_DEFER_LEN
 #define Visible_FCALL_REC
 #define Visible_FBLOCK
+#define Visible_STRING
 #define Visible_SYMTAB
 
 #include <mawk.h>
@@ -51,6 +52,8 @@ extern int yylex(void);
 #endif
 
 extern void eat_nl(void);
+extern double double_zero;
+extern double double_one;
 
 static SYMTAB *save_arglist(const char *);
 static int init_arglist(void);
@@ -59,6 +62,13 @@ static void check_array(SYMTAB *);
 static void check_var(SYMTAB *);
 static void code_array(SYMTAB *);
 static void code_call_id(CA_REC *, SYMTAB *);
+static void code_binary(int, int, int);
+static void code_unary(int, int);
+static void code_cat(int, int);
+static void code_if_test(int);
+static void drop_if_false(int, int);
+static void leave_statement(int);
+static void list_statement(int, int);
 static void field_A2I(void);
 static void free_arglist(void);
 static void improve_arglist(const char *);
@@ -70,6 +80,11 @@ static FBLOCK *active_funct;
 static CA_REC *active_arglist;
       /* when scope is SCOPE_FUNCT  */
 
+static int leave_start = -1, leave_end;
+      /* last next, nextfile, exit or return statement */
+static int dead_list = -1, dead_offset;
+      /* statements from dead_offset in this list are never executed */
+
 #define  code_address(x)  if( is_local(x) ) \
                              code2op(L_PUSHA, (x)->offset) ;\
                           else  code2(_PUSHA, (x)->stval.cp)
@@ -89,7 +104,7 @@ static CA_REC *active_arglist;
 #endif
 #ifndef YYSTYPE_IS_DECLARED
 #define YYSTYPE_IS_DECLARED 1
-#line 81 "parse.y"
+#line 96 "parse.y"
 typedef union YYSTYPE{
   CELL     *cp ;
   SYMTAB   *stp ;
@@ -103,7 +118,7 @@ typedef union YYSTYPE{
   PTR      ptr ;
 } YYSTYPE;
 #endif /* !YYSTYPE_IS_DECLARED */
-#line 106 "parse.c"
+#line 121 "parse.c"
 
 /* compatibility with bison */
 #ifdef YYPARSE_PARAM
@@ -200,42 +215,45 @@ extern int YYPARSE_DECL();
 #define MATCH_FUNC 314
 #define SUB 315
 #define GSUB 316
-#define DO 317
-#define WHILE 318
-#define FOR 319
-#define BREAK 320
-#define CONTINUE 321
-#define IF 322
-#define ELSE 323
-#define DELETE 324
-#define BEGIN 325
-#define END 326
-#define EXIT 327
-#define NEXT 328
-#define NEXTFILE 329
-#define RETURN 330
-#define FUNCTION 331
+#define ASORT 317
+#define ASORTI 318
+#define DO 319
+#define WHILE 320
+#define FOR 321
+#define BREAK 322
+#define CONTINUE 323
+#define IF 324
+#define ELSE 325
+#define DELETE 326
+#define BEGIN 327
+#define END 328
+#define EXIT 329
+#define NEXT 330
+#define NEXTFILE 331
+#define RETURN 332
+#define FUNCTION 333
 #define YYERRCODE 256
 typedef short YYINT;
 static const YYINT yylhs[] = {                           -1,
-    0,    0,   36,   36,   36,   37,   40,   37,   41,   37,
-   42,   37,   43,   44,   37,    1,    1,    2,    2,    3,
+    0,    0,   38,   38,   38,   39,   42,   39,   43,   39,
+   44,   39,   45,   46,   39,    1,    1,    2,    2,    3,
     3,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-   45,   45,   13,   13,   13,   13,   13,   13,   13,   13,
-   13,   13,   13,   13,   13,   13,   13,   46,   13,   47,
-   13,   48,   49,   13,   14,   14,   15,   15,   15,   15,
+   47,   47,   13,   13,   13,   13,   13,   13,   13,   13,
+   13,   13,   13,   13,   13,   13,   13,   48,   13,   49,
+   13,   50,   51,   13,   14,   14,   15,   15,   15,   15,
    15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
    15,   15,   15,   15,   15,   10,   25,   25,   26,   26,
-    8,    5,    4,   27,   27,    6,    6,    6,    7,    7,
-   50,   50,   17,    4,   51,    4,   52,    4,   16,    4,
-    4,   18,   18,   19,   19,   53,   53,   13,   13,   10,
+    8,    5,    4,   28,   28,    6,    6,    6,    7,    7,
+   52,   52,   17,    4,   53,    4,   54,    4,   16,    4,
+    4,   18,   18,   19,   19,   55,   55,   13,   13,   10,
    15,   15,    4,    4,   20,    4,   11,   11,   11,   11,
    11,   15,   13,   13,   13,   13,   13,   13,   13,   15,
-   22,   54,   54,   15,   15,   15,   15,   15,   23,    4,
-    4,   21,   21,   15,   15,   15,   15,   15,   55,   12,
-   12,    9,    9,   15,   28,   28,   24,   24,   38,   29,
-   30,   30,   34,   34,   35,   35,   39,   15,   31,   31,
-   32,   32,   32,   33,   33,
+   22,   56,   56,   57,   15,   30,   30,   27,   27,   27,
+   58,   15,   15,   15,   15,   15,   23,    4,    4,   21,
+   21,   15,   15,   15,   15,   15,   59,   12,   12,    9,
+    9,   15,   29,   29,   24,   24,   40,   31,   32,   32,
+   36,   36,   37,   37,   41,   15,   33,   33,   34,   34,
+   34,   35,   35,
 };
 static const YYINT yylen[] = {                            2,
     1,    2,    1,    1,    2,    1,    0,    3,    0,    3,
@@ -251,165 +269,174 @@ static const YYINT yylen[] = {                            2,
     4,    3,    4,    1,    2,    1,    2,    3,    5,    5,
     5,    6,    7,    3,    6,    2,    1,    2,    6,    2,
     3,    1,    3,    3,    3,    3,    3,    3,    3,    2,
-    5,    1,    3,    3,    4,    4,    1,    6,    1,    2,
-    3,    2,    3,    1,    2,    2,    3,    4,    1,    1,
-    1,    2,    3,    6,    1,    1,    1,    3,    2,    4,
-    2,    2,    0,    1,    1,    3,    1,    3,    2,    2,
-    1,    3,    3,    2,    2,
+    5,    1,    3,    0,    6,    1,    1,    1,    2,    4,
+    2,    3,    4,    4,    1,    6,    1,    2,    3,    2,
+    3,    1,    2,    2,    3,    4,    1,    1,    1,    2,
+    3,    6,    1,    1,    1,    3,    2,    4,    2,    2,
+    0,    1,    1,    3,    1,    3,    2,    2,    1,    3,
+    3,    2,    2,
 };
 static const YYINT yydefred[] = {                         0,
-  167,    0,  149,    0,    0,    0,    0,    0,  117,    0,
-   57,   58,   61,    0,   82,   82,    0,    0,    0,  155,
-  156,    7,    9,    0,    0,    6,   71,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    1,    3,    4,
-    0,    0,    0,   31,   32,   84,   85,   97,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,   22,    0,
-   20,    0,    0,    0,    0,    0,   28,   82,   24,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,   73,   75,
-    0,  120,    0,    0,    0,   72,    0,    0,    0,    0,
-    0,    0,    0,    0,  161,  162,    2,    0,    0,    0,
+  175,    0,  157,    0,    0,    0,    0,    0,  117,    0,
+   57,   58,   61,    0,   82,   82,    0,    0,    0,  163,
+  164,  136,  137,    7,    9,    0,    0,    6,   71,    0,
+    0,    0,    0,    0,    0,    0,    0,   82,    0,    0,
+    1,    3,    4,    0,    0,    0,   31,   32,   84,   85,
+   97,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   22,    0,   20,    0,    0,    0,    0,    0,   28,
+   82,   24,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   73,   75,    0,  120,    0,    0,    0,   72,    0,
+    0,    0,    0,    0,    0,    0,    0,  169,  170,    2,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,   74,   13,   52,   48,   50,    0,    0,    0,
+    0,    0,    0,    0,    0,   74,   13,   52,   48,   50,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  132,  130,    0,  159,    0,
-    5,  152,  150,  151,    0,   17,   25,    0,    0,   26,
-   27,    0,    0,    0,  140,   29,   30,    0,  142,    0,
-   16,   21,   23,  100,    0,  104,    0,    0,  116,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,  121,    0,
-   60,    0,    0,  168,    0,    0,  134,    0,    0,    0,
-    0,    8,   10,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  132,  130,
+    0,    0,  167,    0,    5,  160,  158,  159,    0,   17,
+   25,    0,    0,   26,   27,    0,    0,    0,  148,   29,
+   30,    0,  150,    0,   16,   21,   23,  100,    0,  104,
+    0,    0,  116,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  121,    0,   60,    0,    0,  176,    0,    0,
+  142,    0,    0,    0,    0,    8,   10,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  108,    0,   41,   42,   43,   44,   45,   46,   18,
-   12,   19,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  165,    0,    0,  153,    0,  102,    0,    0,
-    0,    0,  114,  141,  143,   95,    0,  105,  106,    0,
-    0,    0,    0,    0,   86,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  169,    0,    0,  170,    0,  136,
-  135,    0,    0,    0,    0,    0,    0,  148,  133,    0,
-  160,    0,   99,    0,  103,   93,    0,   96,  107,  101,
-   88,    0,    0,    0,    0,    0,    0,    0,    0,  109,
-    0,  173,  175,  172,  174,   81,  131,    0,    0,   53,
-    0,  166,    0,    0,    0,    0,   83,    0,    0,    0,
-  110,  119,  112,  138,   15,    0,    0,  157,  154,  115,
-    0,    0,    0,    0,  113,   98,  158,
+    0,    0,    0,    0,    0,  108,    0,   41,   42,   43,
+   44,   45,   46,   18,   12,   19,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  173,    0,    0,
+  161,    0,  102,    0,    0,    0,    0,  114,  149,  151,
+   95,    0,  105,  106,    0,    0,    0,    0,    0,   86,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  177,
+    0,    0,  178,    0,  144,  143,    0,    0,    0,    0,
+    0,    0,  156,  133,    0,  134,  168,    0,   99,    0,
+  103,   93,    0,   96,  107,  101,   88,    0,    0,    0,
+    0,    0,    0,    0,    0,  109,    0,  181,  183,  180,
+  182,   81,  131,    0,    0,   53,    0,    0,  174,    0,
+    0,    0,    0,   83,    0,    0,    0,  110,  119,  112,
+  146,   15,    0,    0,  165,  162,    0,  138,  135,    0,
+  115,    0,    0,    0,    0,  141,    0,  139,  113,   98,
+  166,    0,  140,
 };
 #if defined(YYDESTRUCT_CALL) || defined(YYSTYPE_TOSTRING)
 static const YYINT yystos[] = {                           0,
   256,  261,  287,  288,  289,  293,  298,  299,  300,  301,
   303,  304,  305,  306,  308,  309,  310,  313,  314,  315,
-  316,  325,  326,  331,  333,  334,  341,  342,  343,  344,
-  346,  347,  348,  355,  361,  362,  363,  369,  370,  371,
-  372,  388,  256,  259,  260,  311,  312,  317,  318,  319,
-  320,  321,  322,  324,  327,  328,  329,  330,  334,  336,
-  337,  346,  349,  350,  351,  353,  354,  360,  378,  385,
-  301,  306,  344,  348,  348,  348,  301,  306,  343,  344,
-  307,  348,  340,  344,  346,  298,  338,  338,  338,  301,
-  301,  301,  373,  374,  306,  308,  369,  348,  267,  268,
-  269,  270,  271,  272,  273,  267,  268,  269,  270,  271,
-  272,  273,  298,  265,  274,  276,  277,  278,  279,  280,
-  281,  282,  283,  284,  285,  375,  348,  288,  289,  290,
-  291,  292,  296,  297,  265,  302,  387,  301,  334,  301,
-  334,  295,  343,  344,  345,  262,  378,  301,  301,  378,
-  378,  301,  306,  346,  378,  378,  378,  346,  378,  256,
-  262,  337,  378,  337,  337,  260,  346,  352,  337,  338,
-  337,  346,  338,  344,  338,  338,  265,  302,  302,  265,
-  302,  263,  301,  364,  365,  301,  302,  306,  346,  346,
-  346,  334,  334,  346,  346,  346,  346,  346,  346,  346,
-  346,  346,  346,  346,  346,  346,  346,  376,  381,  379,
-  380,  306,  346,  346,  346,  346,  346,  346,  346,  334,
-  335,  378,  348,  348,  348,  348,  348,  287,  348,  346,
-  346,  356,  306,  367,  368,  295,  346,  260,  306,  346,
-  346,  338,  378,  378,  378,  323,  384,  260,  302,  346,
-  386,  301,  339,  346,  358,  359,  318,  263,  263,  263,
-  346,  278,  346,  359,  302,  306,  346,  366,  358,  302,
-  302,  265,  265,  346,  346,  346,  346,  345,  302,  265,
-  302,  265,  302,  278,  260,  302,  263,  337,  302,  337,
-  302,  340,  266,  383,  265,  301,  359,  359,  359,  306,
-  264,  265,  302,  265,  302,  302,  306,  356,  377,  275,
-  346,  306,  306,  359,  302,  346,  378,  346,  346,  264,
-  264,  264,  298,  302,  335,  382,  265,  302,  357,  302,
-  264,  302,  346,  345,  378,  378,  302,
+  316,  317,  318,  327,  328,  333,  335,  336,  343,  344,
+  345,  346,  348,  349,  350,  357,  364,  365,  366,  367,
+  373,  374,  375,  376,  394,  256,  259,  260,  311,  312,
+  319,  320,  321,  322,  323,  324,  326,  329,  330,  331,
+  332,  336,  338,  339,  348,  351,  352,  353,  355,  356,
+  363,  382,  389,  301,  306,  346,  350,  350,  350,  301,
+  306,  345,  346,  307,  350,  342,  346,  348,  298,  340,
+  340,  340,  301,  301,  301,  377,  378,  306,  308,  373,
+  350,  267,  268,  269,  270,  271,  272,  273,  267,  268,
+  269,  270,  271,  272,  273,  298,  265,  274,  276,  277,
+  278,  279,  280,  281,  282,  283,  284,  285,  379,  350,
+  288,  289,  290,  291,  292,  296,  297,  265,  302,  391,
+  301,  340,  336,  301,  336,  295,  345,  346,  347,  262,
+  382,  301,  301,  382,  382,  301,  306,  348,  382,  382,
+  382,  348,  382,  256,  262,  339,  382,  339,  339,  260,
+  348,  354,  339,  340,  339,  348,  340,  346,  340,  340,
+  265,  302,  302,  265,  302,  263,  301,  368,  369,  301,
+  302,  306,  348,  348,  348,  336,  336,  348,  348,  348,
+  348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+  348,  380,  385,  383,  384,  306,  348,  348,  348,  348,
+  348,  348,  348,  336,  337,  382,  350,  350,  350,  350,
+  350,  287,  350,  348,  348,  358,  301,  306,  371,  372,
+  295,  348,  260,  306,  348,  348,  340,  382,  382,  382,
+  325,  388,  260,  302,  348,  390,  301,  341,  348,  360,
+  361,  320,  263,  263,  263,  348,  278,  348,  361,  302,
+  306,  348,  370,  360,  302,  302,  265,  265,  348,  348,
+  348,  348,  347,  302,  265,  306,  302,  265,  302,  278,
+  260,  302,  263,  339,  302,  339,  302,  342,  266,  387,
+  265,  301,  361,  361,  361,  306,  264,  265,  302,  265,
+  302,  302,  306,  358,  381,  275,  348,  392,  306,  306,
+  361,  302,  348,  382,  348,  348,  264,  264,  264,  298,
+  302,  337,  386,  265,  302,  359,  265,  302,  362,  393,
+  302,  264,  302,  348,  347,  306,  265,  302,  382,  382,
+  302,  348,  302,
 };
 #endif /* YYDESTRUCT_CALL || YYSTYPE_TOSTRING */
-static const YYINT yydgoto[] = {                         25,
-   59,  221,   60,   61,   87,  253,   83,   27,   28,   29,
-   30,  145,   62,   32,   33,   63,   64,   65,  168,   66,
-   67,   34,  232,  329,  255,  256,   68,   35,   36,   37,
-  184,  185,  268,  234,  235,   38,   39,   40,   41,   93,
-   94,  126,  208,  309,   69,  210,  211,  209,  326,  294,
-  247,   70,  251,  137,   42,
+static const YYINT yydgoto[] = {                         27,
+   62,  225,   63,   64,   90,  258,   86,   29,   30,   31,
+   32,  149,   65,   34,   35,   66,   67,   68,  172,   69,
+   70,   36,  236,  336,  260,  261,  339,   71,   37,   38,
+   39,   40,  188,  189,  273,  239,  240,   41,   42,   43,
+   44,   96,   97,  129,  212,  315,   72,  214,  215,  213,
+  333,  300,  252,   73,  256,  140,  318,  340,   45,
 };
-static const YYINT yysindex[] = {                        57,
-    0,  268,    0, 2322, 2322, 2322,   23, 2202,    0, 2352,
-    0,    0,    0, -286,    0,    0, -246, -243, -207,    0,
-    0,    0,    0, -174,   57,    0,    0, 2322,  349,  122,
- 2637, 2322,  -13, -263, -166, -144, -142,    0,    0,    0,
- -144,  -43, -163,    0,    0,    0,    0,    0, -136, -113,
- -122, -122,  -99, -291,  -70, -122, -122,  -70,    0,  118,
-    0, 2578,  343,  343, 1840,  343,    0,    0,    0,  343,
- 2352, -286, -152, -155, -155, -155, -271,    0,    0,    0,
-    0,    0, -257,   -3, 2143,    0,  -84,  -81,  -79, 2232,
- 2352, 2352, -144, -144,    0,    0,    0,  -65, 2352, 2352,
- 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
- 2352, 2352,    0,    0,    0,    0,    0,  -64, 2352, 2352,
- 2352, 2352, 2352, 2352, 2352,  -68,  -13, 2322, 2322, 2322,
- 2322, 2322,  -40, 2322, 2352,    0,    0, 2352,    0,  -44,
-    0,    0,    0,    0,  -58,    0,    0, 2352, 1870,    0,
-    0, 2352, -122, 2578,    0,    0,    0, 2578,    0, -122,
-    0,    0,    0,    0,  -41,    0, 2604, 2262,    0, 2382,
-  -45, 2485,   30,  -22,   35,   49, 2352,   11,    0, 2352,
-    0, 2352,   15,    0, 2412, 2352,    0, -215, 2497, 2658,
- 2679,    0,    0, 2703, 2703, 2703, 2703, 2703, 2703, 2703,
- 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2352, 2352, 2352,
- 2352,    0,  185,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,  -42,  -42, -155, -155, -155,   23,  -65, 2512,
- 2703,   54,    0,   19,   60,    0, 2524,    0, -256, 2616,
- 2539,   79,    0,    0,    0,    0,  343,    0,    0, 2551,
-  343, 2292,   77, 2703,    0,   86,   51, 2352, 2352, 2352,
- 2703,   53, 2703, -110,    0, -125, 2170,    0,   62,    0,
-    0,   63, 2352, 2703, 2691,  119,  262,    0,    0, 2352,
-    0,   70,    0,   75,    0,    0, 2352,    0,    0,    0,
-    0, -231, 2352, -122, 2352, 2352,  -80,  -69,    7,    0,
-   87,    0,    0,    0,    0,    0,    0,   66,  -68,    0,
- 2197,    0,   82,   50,   11, 2703,    0, 2703, 2566,   87,
-    0,    0,    0,    0,    0, 2352,   23,    0,    0,    0,
- -122, -122, 2703,   84,    0,    0,    0,
+static const YYINT yysindex[] = {                        53,
+    0,  270,    0, 2430, 2430, 2430, -123, 2302,    0, 2462,
+    0,    0,    0, -276,    0,    0, -258, -255, -213,    0,
+    0,    0,    0,    0,    0, -291,   53,    0,    0, 2430,
+  353,  -62, 2755, 2430,   27, -263, -208,    0, -176, -180,
+    0,    0,    0, -176, -139,  -96,    0,    0,    0,    0,
+    0, -166, -158, -202, -202, -152, -281,  -66, -202, -202,
+  -66,    0,  116,    0, 2696,  347,  347, 1894,  347,    0,
+    0,    0,  347, 2462, -276, -201, -265, -265, -265,  -71,
+    0,    0,    0,    0,    0, -257, 2296, 2243,    0, -111,
+ -143, -132, 2334, 2462, 2462, -176, -176,    0,    0,    0,
+ -116, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462, 2462,
+ 2462, 2462, 2462, 2462, 2462,    0,    0,    0,    0,    0,
+ -114, 2462, 2462, 2462, 2462, 2462, 2462, 2462,   -6,   27,
+ 2430, 2430, 2430, 2430, 2430,  -89, 2430, 2462,    0,    0,
+ 2462, -101,    0, -102,    0,    0,    0,    0,  -83,    0,
+    0, 2462, 1926,    0,    0, 2462, -202, 2696,    0,    0,
+    0, 2696,    0, -202,    0,    0,    0,    0,  -99,    0,
+ 2722, 2366,    0, 2494,  -63,  111,   -4,  -41,   -3,    7,
+ 2462,   -2,    0, 2462,    0, 2462,  -24,    0, 2526, 2462,
+    0, -228, 2603, 2776, 2797,    0,    0, 2821, 2821, 2821,
+ 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+ 2821, 2462, 2462, 2462, 2462,    0,  117,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  -95,  -95, -265, -265,
+ -265, -123, -116, 2615, 2821,   15,  -25,    0,  -17,   28,
+    0, 2630,    0, -206, 2734, 2642,   38,    0,    0,    0,
+    0,  347,    0,    0, 2657,  347, 2398,   42, 2821,    0,
+   39,    9, 2462, 2462, 2462, 2821,   14, 2821, -163,    0,
+ -231, 2270,    0,   19,    0,    0,   20, 2462, 2821, 2809,
+ 2830,  264,    0,    0, 2462,    0,    0,   25,    0,   26,
+    0,    0, 2462,    0,    0,    0,    0, -246, 2462, -202,
+ 2462, 2462, -127,  -93,  -76,    0,   37,    0,    0,    0,
+    0,    0,    0,   41,   -6,    0, 2297, -239,    0,   43,
+  -45,   -2, 2821,    0, 2821, 2669,   37,    0,    0,    0,
+    0,    0, 2462, -123,    0,    0,   32,    0,    0, -238,
+    0, -202, -202, 2821,   45,    0, 2462,    0,    0,    0,
+    0, 2684,    0,
 };
 static const YYINT yyrindex[] = {                         0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,  589,    0,    0,  647,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0, 1633,
-  -53,   26, 1691,    0,    0,    0,    0,    0,    0,    0,
-    0, 1459,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  601,    0,    0,  661,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 1681,   31, 2088, 1741,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 1501,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,  531,  705,  937,  995, 1053,    0,  415,    0,    0,
-  473,    0,    0, 1970,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0, 1111,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  541,  721,  961, 1021, 1081,    0,
+  421,    0,    0,  481,    0,    0, 2028,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0, 1749,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,   85,
-    0,    0,    0,    0,  763,    0,    0,    0,    0,    0,
-    0,    0,  145,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  193,    0,    0,    0,    0, -191,
+ 1141,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0, 2442,    0,    0,  107,    0, 1924,    0,    0,
-    0,    0,    0, -212,  273,  348, 2028, 2036, 2048, 2056,
- 2068, 2076, 2088, 2096, 2108, 2116, 2128,    0,    0,    0,
-    0,    0,  198,    0,    0,    0,    0,    0,    0,    0,
-    0,    0, 1517, 1575, 1169, 1227, 1285, 1401,  821,    0,
- -214,    0,    0,    0,  108,    0,    0,    0, 1806,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 1801,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,   76, -241,    0, -216,    0,    0,    0,    0,
- -184,    0, -183,    0,    0, 1924,    0,    0,    0,    0,
-    0,    0,    0,  -35,    0,   73,  -61,    0,    0,    0,
+    0,    0,    0,   48,    0,    0,    0,    0,  781,    0,
+    0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  193,    0,
+    0,    0,    0, -119,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2558,    0,    0,   58,
+    0, 1982,    0,    0,    0,    0,    0,  275,  352, 2116,
+ 2128, 2136, 2148, 2156, 2168, 2176, 2188, 2196, 2208, 2216,
+ 2228,    0,    0,    0,    0,    0, -224,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1561, 1621, 1201, 1261,
+ 1321, 1441,  841,    0, -218,    0,    0,    0,    0,   71,
+    0,    0,    0, 1860,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  -14,    3,    0,
+ -236,    0,    0,    0,    0, -216,    0, -204,    0,    0,
+ 1982,    0,    0,    0,    0,    0,    0,    0,   69,    0,
+   23,  198,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1381,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
- 1343,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,  -92,   81,    0, -108,    0,  879,
+    0,  -42,   36,    0,   47,    0,  901,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0, 2136,    0,    0,    0,    0,
+    0,    0,    0, 2236,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,
 };
 #if YYBTYACC
 static const YYINT yycindex[] = {                         0,
@@ -446,251 +473,263 @@ static const YYINT yycindex[] = {                         0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
     0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,
 };
 #endif
 static const YYINT yygindex[] = {                         0,
-   21,  103,    0,  -50,   17,    0,  161,    0,    0,   -7,
-   -1, -211,    1,    0,   32,    0,    0,    0,    0,    0,
-    0,    0,  141,    0,  229, -115,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,  400,    0,    0,    0,    0,
-    0,    0,    0,    0,   22,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,
+   21,   29,    0,  -53,   84,    0,   98,    0,    0,   -7,
+   -1, -214,    1,    0,  140,    0,    0,    0,    0,    0,
+    0,    0,   96,    0,  189, -174,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  355,    0,    0,
+    0,    0,    0,    0,    0,    0,   22,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
-#define YYTABLESIZE 2988
-static const YYINT yytable[] = {                         79,
-   31,  135,   73,   73,   73,   80,   73,  177,   84,  162,
-   85,   86,  164,  165,  153,  169,  278,   79,   79,  171,
-   26,  284,   79,   79,   79,   31,   73,    8,    9,   77,
-   73,   88,   89,  177,  143,   74,   75,   76,  136,   82,
-  144,   86,   78,   78,  178,   26,   34,   34,   34,   78,
-  139,   34,   34,   34,   90,  154,  139,   91,  158,   98,
-   79,  141,   34,  127,  147,  167,  264,   77,   77,   84,
-  315,  172,  150,  151,   77,  174,  155,  156,  157,  159,
-   90,   89,   86,  163,  170,   78,  270,  139,  173,   34,
-  189,  190,  191,   92,  175,   44,   45,  176,  146,  194,
-  195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
-  205,  206,  207,  192,  193,  334,    2,   90,   89,  213,
-  214,  215,  216,  217,  218,  219,   73,   73,   73,   73,
-   73,   95,   73,   96,  138,  230,   44,   45,  231,  302,
-  133,  134,  297,  298,  299,  113,  220,  222,  237,  240,
-   80,   80,  241,  301,  295,   80,   80,   80,  140,  223,
-  224,  225,  226,  227,  148,  229,   87,   87,  250,  242,
-  254,  314,   86,   87,  243,  244,  303,  261,  182,  245,
-  263,  147,  254,  320,  295,  267,  254,  149,   44,   45,
-   44,   45,    2,   80,  321,  295,  288,   51,   51,   51,
-  290,  152,   51,   51,   51,   11,   11,   11,  274,  275,
-  276,  277,   51,   51,   51,   51,    3,    4,    5,  183,
-  143,  186,    6,   14,   14,   14,  144,    7,    8,    9,
-   10,  134,   11,   12,   13,   14,  236,   15,   16,   17,
-   51,  212,   18,   19,   20,   21,  228,  130,  131,  132,
-   84,  142,   85,  133,  134,    8,    9,   77,  254,  254,
-  254,  233,   78,  106,  107,  108,  109,  110,  111,  112,
-  322,  295,  257,  231,  128,  129,  130,  131,  132,  179,
-  311,  246,  133,  134,   33,   33,   33,  254,  262,   33,
-   33,   33,  258,  316,  113,  318,  319,  259,  179,   33,
-   33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-   33,  260,    1,  331,  295,  317,  265,    2,  280,  143,
-  281,    8,    9,   77,  282,  144,  333,   33,   78,  220,
-  222,   49,   49,   49,   91,   91,   49,   49,   49,   92,
-   92,  287,  293,    3,    4,    5,   49,   49,   49,    6,
-  295,  296,  335,  336,    7,    8,    9,   10,  300,   11,
-   12,   13,   14,  306,   15,   16,   17,  324,  307,   18,
-   19,   20,   21,  160,   49,  312,   44,   45,    2,  161,
-  313,   22,   23,  330,  323,  337,  163,   24,  106,  107,
-  108,  109,  110,  111,  112,  117,  118,  119,  120,  121,
-  122,  123,  124,  125,    3,    4,    5,   82,   77,  164,
-    6,  325,  292,  308,  269,    7,    8,    9,   10,  113,
-   11,   12,   13,   14,   97,   15,   16,   17,   46,   47,
-   18,   19,   20,   21,   48,   49,   50,   51,   52,   53,
-    0,   54,    0,    0,   55,   56,   57,   58,   94,    0,
-    0,   94,   94,   94,   94,    0,   47,   47,   47,    0,
-    0,   47,   47,   47,  120,  121,  122,  123,  124,  125,
-    0,   47,   47,   47,   47,   47,   47,    0,    0,   94,
+#define YYTABLESIZE 3115
+static const YYINT yytable[] = {                         82,
+   33,  138,   76,   76,   76,   83,   76,  181,   87,  166,
+   88,  269,  168,  169,   98,  173,   99,  283,  181,  175,
+   28,   89,   78,   78,  157,  337,  347,   33,   76,   78,
+  136,  137,   76,  308,   47,   47,   47,  147,  139,   47,
+   47,   47,   93,  148,  182,   94,  147,   28,   90,   47,
+   47,   47,   47,   47,   47,  322,   47,   48,  158,  143,
+   89,  162,  338,  348,  145,   78,   89,  151,  171,   89,
+  309,  290,   87,  275,  176,  154,  155,   47,  178,  159,
+  160,  161,  163,  147,    2,   90,  167,   95,  303,  304,
+  305,   89,  141,  193,  194,  195,  116,   89,   91,   92,
+  307,  301,  198,  199,  200,  201,  202,  203,  204,  205,
+  206,  207,  208,  209,  210,  211,  196,  197,  321,  345,
+  144,  142,  217,  218,  219,  220,  221,  222,  223,   76,
+   76,   76,   76,   76,  152,   76,  327,  301,  234,   77,
+   77,  235,  153,   77,   78,   79,   77,   85,  156,  224,
+  226,  186,  242,  245,  174,  146,  246,  187,  177,    8,
+    9,   80,   47,   48,  179,  150,   81,  180,  190,  101,
+  328,  301,  255,  130,  259,    8,    9,   80,  248,  249,
+  137,  266,   81,  250,  268,  151,  259,  329,  301,  272,
+  259,  216,   47,   48,  133,  134,  135,  232,  294,  237,
+  136,  137,  296,  238,  109,  110,  111,  112,  113,  114,
+  115,  241,  279,  280,  281,  282,   87,   87,  342,  301,
+    3,    4,    5,   87,  147,  251,    6,    8,    9,   80,
+  148,    7,    8,    9,   10,  116,   11,   12,   13,   14,
+  247,   15,   16,   17,   91,   91,   18,   19,   20,   21,
+   22,   23,   47,   48,    2,   87,  262,   88,  263,  264,
+  183,   79,   79,  259,  259,  259,   79,   79,   79,  265,
+  227,  228,  229,  230,  231,  267,  233,  270,  235,  285,
+  286,   49,   49,   49,  287,  317,   49,   49,   49,   11,
+   11,   11,  288,  259,   92,   92,   49,   49,   49,  323,
+  293,  325,  326,  301,   79,   80,   80,  299,    1,  302,
+   80,   80,   80,    2,  131,  132,  133,  134,  135,  306,
+  312,  324,  136,  137,   49,  313,  147,   14,   14,   14,
+  319,  320,  148,  344,  330,  224,  226,  346,   82,    3,
+    4,    5,  331,  332,  341,    6,  351,  352,   80,  171,
+    7,    8,    9,   10,  298,   11,   12,   13,   14,   77,
+   15,   16,   17,  349,  350,   18,   19,   20,   21,   22,
+   23,  164,  172,  314,   47,   48,    2,  165,  274,   24,
+   25,  100,    0,    0,  118,   26,  119,  120,  121,  122,
+  123,  124,  125,  126,  127,  128,  123,  124,  125,  126,
+  127,  128,    3,    4,    5,    0,    0,    0,    6,    0,
+    0,    0,  185,    7,    8,    9,   10,    0,   11,   12,
+   13,   14,    0,   15,   16,   17,   49,   50,   18,   19,
+   20,   21,   22,   23,   51,   52,   53,   54,   55,   56,
+    0,   57,    0,    0,   58,   59,   60,   61,   94,    0,
+    0,   94,   94,   94,   94,    0,   51,   51,   51,    0,
+    0,   51,   51,   51,    0,    0,    0,    0,    0,    0,
+    0,   51,   51,   51,   51,    0,    0,    0,    0,   94,
    94,   94,    0,    0,    0,   94,    0,    0,    0,    0,
-   94,   94,   94,   94,    0,   94,   94,   94,   94,   47,
+   94,   94,   94,   94,    0,   94,   94,   94,   94,   51,
    94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
-   94,   94,   94,   94,   94,    0,   94,    0,    0,   94,
-   94,   94,   94,   43,    0,    0,   44,   45,    2,    0,
-    0,   35,   35,   35,    0,    0,   35,   35,   35,  118,
-  119,  120,  121,  122,  123,  124,  125,   35,    0,    0,
-    0,    0,    0,    0,    3,    4,    5,    0,    0,    0,
-    6,    0,    0,    0,    0,    7,    8,    9,   10,    0,
-   11,   12,   13,   14,   35,   15,   16,   17,   46,   47,
-   18,   19,   20,   21,   48,   49,   50,   51,   52,   53,
-    0,   54,    0,    0,   55,   56,   57,   58,  160,    0,
-    0,   44,   45,    2,    0,    0,   36,   36,   36,    0,
-    0,   36,   36,   36,    0,   99,  100,  101,  102,  103,
-  104,  105,   36,    0,    0,    0,    0,    0,    0,    3,
-    4,    5,    0,    0,    0,    6,    0,    0,    0,    0,
-    7,    8,    9,   10,    0,   11,   12,   13,   14,   36,
-   15,   16,   17,   46,   47,   18,   19,   20,   21,   48,
-   49,   50,   51,   52,   53,    0,   54,    0,    0,   55,
-   56,   57,   58,   76,   76,   76,    0,   82,   76,   76,
-   76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
-   76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
-    0,   76,   76,   76,   76,   76,   76,   76,    0,   76,
+   94,   94,   94,   94,   94,   94,   94,    0,   94,    0,
+    0,   94,   94,   94,   94,   46,    0,    0,   47,   48,
+    2,    0,    0,   34,   34,   34,    0,    0,   34,   34,
+   34,  121,  122,  123,  124,  125,  126,  127,  128,   34,
+    0,    0,    0,    0,    0,    0,    3,    4,    5,    0,
+    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
+   10,    0,   11,   12,   13,   14,   34,   15,   16,   17,
+   49,   50,   18,   19,   20,   21,   22,   23,   51,   52,
+   53,   54,   55,   56,    0,   57,    0,    0,   58,   59,
+   60,   61,  164,    0,    0,   47,   48,    2,    0,    0,
+   35,   35,   35,    0,    0,   35,   35,   35,    0,  102,
+  103,  104,  105,  106,  107,  108,   35,    0,    0,    0,
+    0,    0,    0,    3,    4,    5,    0,    0,    0,    6,
+    0,    0,    0,    0,    7,    8,    9,   10,    0,   11,
+   12,   13,   14,   35,   15,   16,   17,   49,   50,   18,
+   19,   20,   21,   22,   23,   51,   52,   53,   54,   55,
+   56,    0,   57,    0,    0,   58,   59,   60,   61,   76,
+   76,   76,    0,   82,   76,   76,   76,   76,   76,   76,
    76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
-   76,    0,   76,   76,   76,    0,    0,   76,   76,   76,
-   76,  118,  118,  118,    0,   82,  118,  118,  118,  118,
+   76,   76,   76,   76,   76,   76,    0,   76,   76,   76,
+   76,   76,   76,   76,    0,   76,   76,   76,   76,   76,
+   76,   76,   76,   76,   76,   76,   76,    0,   76,   76,
+   76,    0,    0,   76,   76,   76,   76,   76,   76,  118,
+  118,  118,    0,   82,  118,  118,  118,  118,  118,  118,
   118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
-  118,  118,  118,  118,  118,  118,  118,  118,    0,  118,
   118,  118,  118,  118,  118,  118,    0,  118,  118,  118,
-  118,  118,  118,  118,  118,  118,  118,  118,  118,    0,
-  118,  118,  118,    0,    0,  118,  118,  118,  118,   59,
+  118,  118,  118,  118,    0,  118,  118,  118,  118,  118,
+  118,  118,  118,  118,  118,  118,  118,    0,  118,  118,
+  118,    0,    0,  118,  118,  118,  118,  118,  118,   59,
    59,   59,    0,   82,   59,   59,   59,   59,   59,   59,
    59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
    59,   59,   59,   59,   59,   59,    0,   59,   59,   59,
    59,   59,   59,   59,    0,   59,   59,   59,    0,   59,
    59,   59,   59,   59,   59,   59,   59,    0,   59,   59,
    59,    0,    0,   59,   59,   59,   59,   59,   59,   59,
-    0,   82,   59,   59,   59,   76,   76,   76,   76,   76,
-   76,   76,   59,   59,   59,   59,   59,   59,   59,   59,
-   59,   59,   59,   59,    0,   59,   59,   59,   59,   59,
-   59,   59,    0,    0,   59,   59,    0,   59,   59,   59,
-   59,   59,   59,   59,   59,    0,   59,   59,   59,    0,
-    0,   59,   59,   59,   59,  137,  137,  137,    0,    0,
-  137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
-  137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
-  137,  137,    0,  137,  137,  137,  137,  137,  137,  137,
-    0,  137,  137,  137,  137,  137,  137,    0,  137,  137,
-  137,  137,  137,    0,  137,  137,  137,    0,    0,  137,
-  137,  137,  137,  122,  122,  122,    0,    0,  122,  122,
-  122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
-  122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
-    0,  122,  122,  122,  122,  122,  122,  122,    0,  122,
-  122,  122,    0,  122,  122,  122,  122,  122,  122,  122,
-  122,    0,  122,  122,  122,    0,    0,  122,  122,  122,
-  122,  145,  145,  145,    0,    0,  145,  145,  145,  145,
+   59,   59,    0,   82,   59,   59,   59,   76,   76,   76,
+   76,   76,   76,   76,   59,   59,   59,   59,   59,   59,
+   59,   59,   59,   59,   59,   59,    0,   59,   59,   59,
+   59,   59,   59,   59,    0,    0,   59,   59,    0,   59,
+   59,   59,   59,   59,   59,   59,   59,    0,   59,   59,
+   59,    0,    0,   59,   59,   59,   59,   59,   59,  145,
+  145,  145,    0,    0,  145,  145,  145,  145,  145,  145,
   145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-  145,  145,  145,  145,  145,  145,  145,  145,    0,  145,
-  145,  145,  145,  145,  145,  145,    0,    0,  145,  145,
-  145,  145,  145,  145,  145,  145,  145,  145,  145,    0,
-  145,  145,  145,    0,    0,  145,  145,  145,  145,   67,
+  145,  145,  145,  145,  145,  145,    0,  145,  145,  145,
+  145,  145,  145,  145,    0,  145,  145,  145,  145,  145,
+  145,    0,  145,  145,  145,  145,  145,    0,  145,  145,
+  145,    0,    0,  145,  145,  145,  145,  145,  145,  122,
+  122,  122,    0,    0,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,    0,  122,  122,  122,
+  122,  122,  122,  122,    0,  122,  122,  122,    0,  122,
+  122,  122,  122,  122,  122,  122,  122,    0,  122,  122,
+  122,    0,    0,  122,  122,  122,  122,  122,  122,  153,
+  153,  153,    0,    0,  153,  153,  153,  153,  153,  153,
+  153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+  153,  153,  153,  153,  153,  153,    0,  153,  153,  153,
+  153,  153,  153,  153,    0,    0,  153,  153,  153,  153,
+  153,  153,  153,  153,  153,  153,  153,    0,  153,  153,
+  153,    0,    0,  153,  153,  153,  153,  153,  153,   67,
    67,   67,    0,    0,   67,   67,   67,   67,   67,   67,
    67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
    67,   67,   67,   67,   67,   67,    0,   67,   67,   67,
    67,   67,   67,   67,    0,   67,   67,    0,   67,   67,
    67,   67,   67,   67,   67,   67,   67,    0,   67,   67,
-   67,    0,    0,   67,   67,   67,   67,  111,  111,  111,
-    0,    0,  111,  111,  111,  111,  111,  111,  111,  111,
+   67,    0,    0,   67,   67,   67,   67,   67,   67,  111,
+  111,  111,    0,    0,  111,  111,  111,  111,  111,  111,
   111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
-  111,  111,  111,  111,    0,  111,  111,  111,  111,  111,
-  111,  111,    0,  111,  111,  111,    0,  111,  111,  111,
-  111,  111,  111,  111,  111,    0,  111,  111,  111,    0,
-    0,  111,  111,  111,  111,   69,   69,   69,    0,    0,
+  111,  111,  111,  111,  111,  111,    0,  111,  111,  111,
+  111,  111,  111,  111,    0,  111,  111,  111,    0,  111,
+  111,  111,  111,  111,  111,  111,  111,    0,  111,  111,
+  111,    0,    0,  111,  111,  111,  111,  111,  111,   69,
+   69,   69,    0,    0,   69,   69,   69,   69,   69,   69,
    69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
-   69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
-   69,   69,    0,   69,   69,   69,   69,   69,   69,   69,
-    0,   69,    0,    0,   69,   69,   69,   69,   69,   69,
-   69,   69,   69,    0,   69,   69,   69,    0,    0,   69,
-   69,   69,   69,   70,   70,   70,    0,    0,   70,   70,
-   70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+   69,   69,   69,   69,   69,   69,    0,   69,   69,   69,
+   69,   69,   69,   69,    0,   69,    0,    0,   69,   69,
+   69,   69,   69,   69,   69,   69,   69,    0,   69,   69,
+   69,    0,    0,   69,   69,   69,   69,   69,   69,   70,
+   70,   70,    0,    0,   70,   70,   70,   70,   70,   70,
    70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
-    0,   70,   70,   70,   70,   70,   70,   70,    0,   70,
-    0,    0,   70,   70,   70,   70,   70,   70,   70,   70,
-   70,    0,   70,   70,   70,    0,    0,   70,   70,   70,
-   70,   68,   68,   68,    0,    0,   68,   68,   68,   68,
+   70,   70,   70,   70,   70,   70,    0,   70,   70,   70,
+   70,   70,   70,   70,    0,   70,    0,    0,   70,   70,
+   70,   70,   70,   70,   70,   70,   70,    0,   70,   70,
+   70,    0,    0,   70,   70,   70,   70,   70,   70,   68,
+   68,   68,    0,    0,   68,   68,   68,   68,   68,   68,
    68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
-   68,   68,   68,   68,   68,   68,   68,   68,    0,   68,
-   68,   68,   68,   68,   68,   68,    0,   68,    0,    0,
-   68,   68,   68,   68,   68,   68,   68,   68,   68,    0,
-   68,   68,   68,    0,    0,   68,   68,   68,   68,  146,
-  146,  146,    0,    0,  146,  146,  146,  146,  146,  146,
-  146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
-  146,  146,  146,  146,  146,  146,    0,  146,  146,  146,
-  146,  146,  146,  146,    0,  146,    0,    0,  146,  146,
-  146,  146,  146,  146,  146,  146,  146,    0,  146,  146,
-  146,    0,    0,  146,  146,  146,  146,   64,   64,   64,
-    0,    0,   64,   64,   64,   64,   64,   64,   64,   64,
+   68,   68,   68,   68,   68,   68,    0,   68,   68,   68,
+   68,   68,   68,   68,    0,   68,    0,    0,   68,   68,
+   68,   68,   68,   68,   68,   68,   68,    0,   68,   68,
+   68,    0,    0,   68,   68,   68,   68,   68,   68,  154,
+  154,  154,    0,    0,  154,  154,  154,  154,  154,  154,
+  154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+  154,  154,  154,  154,  154,  154,    0,  154,  154,  154,
+  154,  154,  154,  154,    0,  154,    0,    0,  154,  154,
+  154,  154,  154,  154,  154,  154,  154,    0,  154,  154,
+  154,    0,    0,  154,  154,  154,  154,  154,  154,   64,
+   64,   64,    0,    0,   64,   64,   64,   64,   64,   64,
    64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
-   64,   64,   64,   64,    0,   64,   64,   64,   64,   64,
-   64,   64,    0,   64,    0,    0,   64,   64,   64,   64,
-   64,   64,   64,   64,   64,    0,   64,   64,   64,    0,
-    0,   64,   64,   64,   64,   65,   65,   65,    0,    0,
-   65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+   64,   64,   64,   64,   64,   64,    0,   64,   64,   64,
+   64,   64,   64,   64,    0,   64,    0,    0,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,    0,   64,   64,
+   64,    0,    0,   64,   64,   64,   64,   64,   64,   65,
+   65,   65,    0,    0,   65,   65,   65,   65,   65,   65,
    65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
-   65,   65,    0,   65,   65,   65,   65,   65,   65,   65,
-    0,   65,    0,    0,   65,   65,   65,   65,   65,   65,
-   65,   65,   65,    0,   65,   65,   65,    0,    0,   65,
-   65,   65,   65,   66,   66,   66,    0,    0,   66,   66,
+   65,   65,   65,   65,   65,   65,    0,   65,   65,   65,
+   65,   65,   65,   65,    0,   65,    0,    0,   65,   65,
+   65,   65,   65,   65,   65,   65,   65,    0,   65,   65,
+   65,    0,    0,   65,   65,   65,   65,   65,   65,   66,
+   66,   66,    0,    0,   66,   66,   66,   66,   66,   66,
    66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-   66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-    0,   66,   66,   66,   66,   66,   66,   66,    0,   66,
-    0,    0,   66,   66,   66,   66,   66,   66,   66,   66,
-   66,    0,   66,   66,   66,    0,    0,   66,   66,   66,
-   66,  111,  111,  111,    0,    0,  111,  111,  111,  110,
-  110,  110,  110,  110,  110,  110,  111,  111,  111,  111,
-  111,  111,  111,  111,  111,  111,  111,  111,    0,  111,
-  111,  111,  111,  111,  111,  111,    0,    0,  111,  111,
-    0,  111,  111,  111,  111,  111,  111,  111,  111,    0,
-  111,  111,  111,    0,    0,  111,  111,  111,  111,  147,
-  147,  147,    0,    0,  147,  147,  147,  147,  147,  147,
-  147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
-  147,  147,  147,  147,  147,  147,    0,  147,  147,  147,
-  147,  147,  147,  147,    0,  147,  147,  147,  147,    0,
-    0,    0,  147,  147,  147,  147,    0,    0,  147,  147,
-  147,    0,    0,  147,  147,  147,  147,  144,  144,  144,
-    0,    0,  144,  144,  144,  144,  144,  144,  144,  144,
-  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-  144,  144,  144,  144,    0,  144,  144,  144,  144,  144,
-  144,  144,    0,    0,  144,  144,  144,    0,    0,    0,
-  144,  144,  144,  144,    0,    0,  144,  144,  144,    0,
-    0,  144,  144,  144,  144,   62,   62,   62,    0,    0,
-   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   66,   66,   66,   66,   66,   66,    0,   66,   66,   66,
+   66,   66,   66,   66,    0,   66,    0,    0,   66,   66,
+   66,   66,   66,   66,   66,   66,   66,    0,   66,   66,
+   66,    0,    0,   66,   66,   66,   66,   66,   66,  111,
+  111,  111,    0,    0,  111,  111,  111,  110,  110,  110,
+  110,  110,  110,  110,  111,  111,  111,  111,  111,  111,
+  111,  111,  111,  111,  111,  111,    0,  111,  111,  111,
+  111,  111,  111,  111,    0,    0,  111,  111,    0,  111,
+  111,  111,  111,  111,  111,  111,  111,    0,  111,  111,
+  111,    0,    0,  111,  111,  111,  111,  111,  111,  155,
+  155,  155,    0,    0,  155,  155,  155,  155,  155,  155,
+  155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+  155,  155,  155,  155,  155,  155,    0,  155,  155,  155,
+  155,  155,  155,  155,    0,  155,  155,  155,  155,    0,
+    0,    0,  155,  155,  155,  155,    0,    0,  155,  155,
+  155,    0,    0,  155,  155,  155,  155,  155,  155,  152,
+  152,  152,    0,    0,  152,  152,  152,  152,  152,  152,
+  152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+  152,  152,  152,  152,  152,  152,    0,  152,  152,  152,
+  152,  152,  152,  152,    0,    0,  152,  152,  152,    0,
+    0,    0,  152,  152,  152,  152,    0,    0,  152,  152,
+  152,    0,    0,  152,  152,  152,  152,  152,  152,   62,
+   62,   62,    0,    0,   62,   62,   62,   62,   62,   62,
    62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-   62,   62,    0,   62,   62,   62,    0,    0,    0,   62,
-    0,   62,    0,    0,   62,   62,   62,   62,   62,   62,
-   62,   62,   62,    0,   62,   62,   62,    0,    0,   62,
-   62,   62,   62,   63,   63,   63,    0,    0,   63,   63,
+   62,   62,   62,   62,   62,   62,    0,   62,   62,   62,
+    0,    0,    0,   62,    0,   62,    0,    0,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,    0,   62,   62,
+   62,    0,    0,   62,   62,   62,   62,   62,   62,   63,
+   63,   63,    0,    0,   63,   63,   63,   63,   63,   63,
    63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
-   63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
-    0,   63,   63,   63,    0,    0,    0,   63,    0,   63,
-    0,    0,   63,   63,   63,   63,   63,   63,   63,   63,
-   63,    0,   63,   63,   63,    0,    0,   63,   63,   63,
-   63,  122,  122,  122,    0,    0,  122,  122,  122,    0,
-    0,    0,    0,    0,    0,    0,  122,  122,  122,  122,
-  122,  122,  122,  122,  122,  122,  122,  122,    0,  122,
-  122,  122,  122,  122,  122,  122,    0,    0,  122,  122,
-    0,  122,  122,  122,  122,  122,  122,  122,  122,    0,
-  122,  122,  122,    0,    0,  122,  122,  122,  122,   55,
+   63,   63,   63,   63,   63,   63,    0,   63,   63,   63,
+    0,    0,    0,   63,    0,   63,    0,    0,   63,   63,
+   63,   63,   63,   63,   63,   63,   63,    0,   63,   63,
+   63,    0,    0,   63,   63,   63,   63,   63,   63,  122,
+  122,  122,    0,    0,  122,  122,  122,    0,    0,    0,
+    0,    0,    0,    0,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,    0,  122,  122,  122,
+  122,  122,  122,  122,    0,    0,  122,  122,    0,  122,
+  122,  122,  122,  122,  122,  122,  122,    0,  122,  122,
+  122,    0,    0,  122,  122,  122,  122,  122,  122,   55,
    55,   55,    0,    0,   55,   55,   55,    0,    0,    0,
     0,    0,    0,    0,   55,   55,   55,   55,   55,   55,
    55,   55,   55,   55,   55,   55,    0,   55,    0,    0,
     0,    0,    0,   55,    0,    0,    0,    0,   55,   55,
    55,   55,   55,   55,   55,   55,   55,    0,   55,   55,
-   55,    0,    0,   55,   55,   55,   55,   56,   56,   56,
-    0,    0,   56,   56,   56,    0,    0,    0,    0,    0,
-    0,    0,   56,   56,   56,   56,   56,   56,   56,   56,
-   56,   56,   56,   56,    0,   56,    0,    0,    0,    0,
-    0,   56,    0,    0,    0,    0,   56,   56,   56,   56,
-   56,   56,   56,   56,   56,    0,   56,   56,   56,    0,
-    0,   56,   56,   56,   56,   59,    0,    0,   82,    0,
-    0,    0,   76,   76,   76,   76,   76,   76,   76,   59,
-    0,   59,   59,    0,   59,   59,   59,   59,   59,   59,
-   59,    0,   59,   59,   59,   59,   59,   59,   59,  166,
-    0,   59,   59,    0,   59,   59,   59,    0,   59,   59,
-   59,   59,    0,   59,   59,   59,    0,    0,   59,   59,
-   59,   59,    0,    0,    0,    0,    3,    4,    5,  238,
-    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
-   10,    0,   11,   12,   13,   14,    0,   15,   16,   17,
-    0,    0,   18,   19,   20,   21,    3,    4,    5,    0,
-    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
-   10,    0,   11,   12,   13,  239,    0,   15,   16,   17,
-    0,    0,   18,   19,   20,   21,   82,    0,    0,    0,
-   76,   76,   76,   76,   76,   76,   76,   59,    0,   59,
-   59,   59,   59,   59,   59,   59,   59,   59,   59,    0,
-   59,   59,   59,   59,   59,   59,   59,    0,    0,   59,
-   59,    0,   59,   59,   59,    0,   59,   59,   59,   59,
-    0,   59,   59,   59,  122,    0,   59,   59,   59,   59,
-    0,    0,    0,  122,    0,  122,  122,  122,  122,  122,
-  122,  122,  122,  122,  122,    0,  122,  122,  122,  122,
-  122,  122,  122,    0,    0,  122,  122,    0,  122,  122,
-  122,    0,  122,  122,  122,  122,    0,  122,  122,  122,
-    0,    0,  122,  122,  122,  122,   37,   37,   37,    0,
-    0,   37,   37,   37,   38,   38,   38,    0,    0,   38,
+   55,    0,    0,   55,   55,   55,   55,   55,   55,   56,
+   56,   56,    0,    0,   56,   56,   56,    0,    0,    0,
+    0,    0,    0,    0,   56,   56,   56,   56,   56,   56,
+   56,   56,   56,   56,   56,   56,    0,   56,    0,    0,
+    0,    0,    0,   56,    0,    0,    0,    0,   56,   56,
+   56,   56,   56,   56,   56,   56,   56,    0,   56,   56,
+   56,    0,    0,   56,   56,   56,   56,   56,   56,   59,
+    0,    0,   82,    0,    0,    0,   76,   76,   76,   76,
+   76,   76,   76,   59,    0,   59,   59,    0,   59,   59,
+   59,   59,   59,   59,   59,    0,   59,   59,   59,   59,
+   59,   59,   59,  170,    0,   59,   59,    0,   59,   59,
+   59,    0,   59,   59,   59,   59,    0,   59,   59,   59,
+    0,    0,   59,   59,   59,   59,   59,   59,    0,    0,
+    3,    4,    5,    0,    0,  243,    6,    0,    0,    0,
+    0,    7,    8,    9,   10,    0,   11,   12,   13,   14,
+    0,   15,   16,   17,    0,    0,   18,   19,   20,   21,
+   22,   23,    3,    4,    5,    0,    0,    0,    6,    0,
+    0,    0,    0,    7,    8,    9,   10,    0,   11,   12,
+   13,  244,    0,   15,   16,   17,    0,    0,   18,   19,
+   20,   21,   22,   23,   82,    0,    0,    0,   76,   76,
+   76,   76,   76,   76,   76,   59,    0,   59,   59,   59,
+   59,   59,   59,   59,   59,   59,   59,    0,   59,   59,
+   59,   59,   59,   59,   59,    0,    0,   59,   59,    0,
+   59,   59,   59,    0,   59,   59,   59,   59,    0,   59,
+   59,   59,  122,    0,   59,   59,   59,   59,   59,   59,
+    0,  122,    0,  122,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,    0,  122,  122,  122,  122,  122,  122,
+  122,    0,    0,  122,  122,    0,  122,  122,  122,    0,
+  122,  122,  122,  122,    0,  122,  122,  122,    0,    0,
+  122,  122,  122,  122,  122,  122,   33,   33,   33,    0,
+    0,   33,   33,   33,    0,    0,    0,    0,    0,    0,
+    0,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+   33,   33,   33,    0,   36,   36,   36,    0,    0,   36,
+   36,   36,    0,    0,    0,    0,   37,   37,   37,   33,
+   36,   37,   37,   37,   38,   38,   38,    0,    0,   38,
    38,   38,   37,    0,    0,    0,   39,   39,   39,    0,
-   38,   39,   39,   39,   40,   40,   40,    0,    0,   40,
+   38,   39,   39,   39,   40,   40,   40,   36,    0,   40,
    40,   40,   39,    0,    0,    0,  123,  123,  123,   37,
    40,  123,  123,  123,  124,  124,  124,   38,    0,  124,
   124,  124,  123,    0,    0,    0,  125,  125,  125,   39,
@@ -699,299 +738,312 @@ static const YYINT yytable[] = {                         79,
   126,  127,  127,  127,  128,  128,  128,  124,    0,  128,
   128,  128,  127,    0,    0,    0,  129,  129,  129,  125,
   128,  129,  129,  129,   54,   54,   54,  126,    0,   54,
-   54,   54,  129,    0,    0,    0,    0,  180,    0,  127,
-   54,    0,    0,    0,    0,    0,  115,  128,  116,  117,
-  118,  119,  120,  121,  122,  123,  124,  125,    0,  129,
-    0,    0,    0,    0,  304,    0,    0,   54,    0,    0,
-    0,    0,    0,  115,  181,  116,  117,  118,  119,  120,
-  121,  122,  123,  124,  125,    0,    0,    0,    0,    0,
-    0,  327,    0,    0,    0,    0,    0,    0,    0,    0,
-  115,  305,  116,  117,  118,  119,  120,  121,  122,  123,
-  124,  125,    0,    0,    0,    0,    0,    0,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,  328,    7,
-    8,    9,   71,    0,   11,   12,   13,   72,   81,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,  187,   11,   12,   13,  188,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,  249,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,  291,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   71,    0,   11,   12,   13,   72,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
+   54,   54,  129,    0,    0,    0,    0,  184,    0,  127,
+   54,    0,    0,    0,    0,    0,  118,  128,  119,  120,
+  121,  122,  123,  124,  125,  126,  127,  128,    0,  129,
+    0,    0,    0,    0,  310,    0,    0,   54,    0,    0,
+    0,    0,    0,  118,  185,  119,  120,  121,  122,  123,
+  124,  125,  126,  127,  128,    0,    0,    0,    0,    0,
+    0,  334,  109,  110,  111,  112,  113,  114,  115,    0,
+  118,  311,  119,  120,  121,  122,  123,  124,  125,  126,
+  127,  128,    0,    0,    0,    0,    0,    0,    3,    4,
+    5,    0,    0,  116,    6,    0,    0,  183,  335,    7,
+    8,    9,   74,    0,   11,   12,   13,   75,   84,   15,
+   16,   17,    0,    0,   18,   19,   20,   21,   22,   23,
+    3,    4,    5,    0,    0,    0,    6,    0,    0,    0,
+    0,    7,    8,    9,   10,  191,   11,   12,   13,  192,
+    0,   15,   16,   17,    0,    0,   18,   19,   20,   21,
+   22,   23,    3,    4,    5,    0,    0,    0,    6,    0,
+    0,    0,    0,    7,    8,    9,   10,  254,   11,   12,
+   13,   14,    0,   15,   16,   17,    0,    0,   18,   19,
+   20,   21,   22,   23,    3,    4,    5,    0,    0,    0,
+    6,    0,    0,    0,    0,    7,    8,    9,   10,  297,
+   11,   12,   13,   14,    0,   15,   16,   17,    0,    0,
+   18,   19,   20,   21,   22,   23,    3,    4,    5,    0,
+    0,    0,    6,    0,    0,    0,    0,    7,    8,    9,
+   74,    0,   11,   12,   13,   75,    0,   15,   16,   17,
+    0,    0,   18,   19,   20,   21,   22,   23,    3,    4,
     5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
     8,    9,   10,    0,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,  252,    0,   11,   12,   13,   14,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,    3,    4,
-    5,    0,    0,    0,    6,    0,    0,    0,    0,    7,
-    8,    9,   10,    0,   11,   12,   13,  266,    0,   15,
-   16,   17,    0,    0,   18,   19,   20,   21,  171,  171,
-  171,    0,    0,    0,  171,    0,    0,    0,    0,  171,
-  171,  171,  171,    0,  171,  171,  171,  171,    0,  171,
-  171,  171,    0,    0,  171,  171,  171,  171,  115,    0,
-  116,  117,  118,  119,  120,  121,  122,  123,  124,  125,
-  115,    0,  116,  117,  118,  119,  120,  121,  122,  123,
-  124,  125,    0,    0,    0,  115,  181,  116,  117,  118,
-  119,  120,  121,  122,  123,  124,  125,  115,  271,  116,
-  117,  118,  119,  120,  121,  122,  123,  124,  125,    0,
-    0,    0,  115,  279,  116,  117,  118,  119,  120,  121,
-  122,  123,  124,  125,  115,  283,  116,  117,  118,  119,
-  120,  121,  122,  123,  124,  125,   44,   45,    0,  115,
-  286,  116,  117,  118,  119,  120,  121,  122,  123,  124,
-  125,  115,  289,  116,  117,  118,  119,  120,  121,  122,
-  123,  124,  125,  248,    0,    0,    0,  332,    0,    0,
-    0,    0,    0,    0,    0,  285,    0,  115,    0,  116,
-  117,  118,  119,  120,  121,  122,  123,  124,  125,  115,
-    0,  116,  117,  118,  119,  120,  121,  122,  123,  124,
-  125,  114,    0,    0,    0,    0,    0,    0,    0,    0,
-  115,    0,  116,  117,  118,  119,  120,  121,  122,  123,
-  124,  125,  272,    0,    0,    0,    0,    0,    0,    0,
-    0,  115,    0,  116,  117,  118,  119,  120,  121,  122,
-  123,  124,  125,  273,    0,    0,    0,    0,    0,    0,
-    0,    0,  115,    0,  116,  117,  118,  119,  120,  121,
-  122,  123,  124,  125,  115,  310,  116,  117,  118,  119,
-  120,  121,  122,  123,  124,  125,  115,    0,  116,  117,
-  118,  119,  120,  121,  122,  123,  124,  125,
+   16,   17,    0,    0,   18,   19,   20,   21,   22,   23,
+    3,    4,    5,    0,    0,    0,    6,    0,    0,    0,
+    0,    7,    8,    9,  257,    0,   11,   12,   13,   14,
+    0,   15,   16,   17,    0,    0,   18,   19,   20,   21,
+   22,   23,    3,    4,    5,    0,    0,    0,    6,    0,
+    0,    0,    0,    7,    8,    9,   10,    0,   11,   12,
+   13,  271,    0,   15,   16,   17,    0,    0,   18,   19,
+   20,   21,   22,   23,  179,  179,  179,    0,    0,    0,
+  179,    0,    0,    0,    0,  179,  179,  179,  179,    0,
+  179,  179,  179,  179,    0,  179,  179,  179,    0,    0,
+  179,  179,  179,  179,  179,  179,  118,    0,  119,  120,
+  121,  122,  123,  124,  125,  126,  127,  128,  118,    0,
+  119,  120,  121,  122,  123,  124,  125,  126,  127,  128,
+    0,    0,    0,  118,  276,  119,  120,  121,  122,  123,
+  124,  125,  126,  127,  128,  118,  284,  119,  120,  121,
+  122,  123,  124,  125,  126,  127,  128,    0,    0,    0,
+  118,  289,  119,  120,  121,  122,  123,  124,  125,  126,
+  127,  128,  118,  292,  119,  120,  121,  122,  123,  124,
+  125,  126,  127,  128,   47,   48,    0,  118,  295,  119,
+  120,  121,  122,  123,  124,  125,  126,  127,  128,  118,
+  343,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+  128,  253,    0,    0,    0,  353,    0,    0,    0,    0,
+    0,    0,    0,  291,    0,  118,    0,  119,  120,  121,
+  122,  123,  124,  125,  126,  127,  128,  118,    0,  119,
+  120,  121,  122,  123,  124,  125,  126,  127,  128,  117,
+    0,    0,    0,    0,    0,    0,    0,    0,  118,    0,
+  119,  120,  121,  122,  123,  124,  125,  126,  127,  128,
+  277,    0,    0,    0,    0,    0,    0,    0,    0,  118,
+    0,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+  128,  278,    0,    0,    0,    0,    0,    0,    0,    0,
+  118,    0,  119,  120,  121,  122,  123,  124,  125,  126,
+  127,  128,  118,  316,  119,  120,  121,  122,  123,  124,
+  125,  126,  127,  128,  118,    0,  119,  120,  121,  122,
+  123,  124,  125,  126,  127,  128,  120,  121,  122,  123,
+  124,  125,  126,  127,  128,
 };
 static const YYINT yycheck[] = {                          7,
-    0,  265,    4,    5,    6,    7,    8,  265,   10,   60,
-   10,  298,   63,   64,  306,   66,  228,  259,  260,   70,
-    0,  278,  264,  265,  266,   25,   28,  299,  300,  301,
-   32,   15,   16,  265,   42,    4,    5,    6,  302,    8,
-   42,  298,  259,  260,  302,   25,  259,  260,  261,  266,
-  265,  264,  265,  266,  301,   55,   36,  301,   58,   28,
-  302,   41,  275,   32,   43,   65,  182,  259,  260,   71,
-  302,   71,   51,   52,  266,   77,   55,   56,   57,   58,
-  265,  265,  298,   62,   68,  302,  302,  302,   72,  302,
-   90,   91,   92,  301,   78,  259,  260,   81,  262,   99,
-  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
-  110,  111,  112,   93,   94,  327,  261,  302,  302,  119,
-  120,  121,  122,  123,  124,  125,  128,  129,  130,  131,
-  132,  306,  134,  308,  301,  135,  259,  260,  138,  265,
-  296,  297,  258,  259,  260,  298,  126,  126,  148,  149,
-  259,  260,  152,  264,  265,  264,  265,  266,  301,  128,
-  129,  130,  131,  132,  301,  134,  259,  260,  168,  153,
-  170,  287,  298,  266,  153,  154,  302,  177,  263,  158,
-  180,  160,  182,  264,  265,  185,  186,  301,  259,  260,
-  259,  260,  261,  302,  264,  265,  247,  259,  260,  261,
-  251,  301,  264,  265,  266,  259,  260,  261,  208,  209,
-  210,  211,  274,  275,  276,  277,  287,  288,  289,  301,
-  228,  301,  293,  259,  260,  261,  228,  298,  299,  300,
-  301,  297,  303,  304,  305,  306,  295,  308,  309,  310,
-  302,  306,  313,  314,  315,  316,  287,  290,  291,  292,
-  252,  295,  252,  296,  297,  299,  300,  301,  258,  259,
-  260,  306,  306,  267,  268,  269,  270,  271,  272,  273,
-  264,  265,  318,  273,  288,  289,  290,  291,  292,  302,
-  280,  323,  296,  297,  259,  260,  261,  287,  278,  264,
-  265,  266,  263,  293,  298,  295,  296,  263,  302,  274,
-  275,  276,  277,  278,  279,  280,  281,  282,  283,  284,
-  285,  263,  256,  264,  265,  294,  302,  261,  265,  327,
-  302,  299,  300,  301,  265,  327,  326,  302,  306,  309,
-  309,  259,  260,  261,  259,  260,  264,  265,  266,  259,
-  260,  263,  266,  287,  288,  289,  274,  275,  276,  293,
-  265,  301,  331,  332,  298,  299,  300,  301,  306,  303,
-  304,  305,  306,  302,  308,  309,  310,  302,  306,  313,
-  314,  315,  316,  256,  302,  306,  259,  260,  261,  262,
-  306,  325,  326,  302,  298,  302,  302,  331,  267,  268,
-  269,  270,  271,  272,  273,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,  287,  288,  289,  263,  302,  302,
-  293,  309,  252,  273,  186,  298,  299,  300,  301,  298,
-  303,  304,  305,  306,   25,  308,  309,  310,  311,  312,
-  313,  314,  315,  316,  317,  318,  319,  320,  321,  322,
-   -1,  324,   -1,   -1,  327,  328,  329,  330,  256,   -1,
+    0,  265,    4,    5,    6,    7,    8,  265,   10,   63,
+   10,  186,   66,   67,  306,   69,  308,  232,  265,   73,
+    0,  298,  259,  260,  306,  265,  265,   27,   30,  266,
+  296,  297,   34,  265,  259,  260,  261,   45,  302,  264,
+  265,  266,  301,   45,  302,  301,  265,   27,  265,  274,
+  275,  276,  277,  278,  279,  302,  259,  260,   58,   39,
+  265,   61,  302,  302,   44,  302,  298,   46,   68,  298,
+  302,  278,   74,  302,   74,   54,   55,  302,   80,   58,
+   59,   60,   61,  302,  261,  302,   65,  301,  263,  264,
+  265,  298,  301,   93,   94,   95,  298,  302,   15,   16,
+  264,  265,  102,  103,  104,  105,  106,  107,  108,  109,
+  110,  111,  112,  113,  114,  115,   96,   97,  293,  334,
+  301,   38,  122,  123,  124,  125,  126,  127,  128,  131,
+  132,  133,  134,  135,  301,  137,  264,  265,  138,  259,
+  260,  141,  301,    4,    5,    6,  266,    8,  301,  129,
+  129,  263,  152,  153,   71,  295,  156,  301,   75,  299,
+  300,  301,  259,  260,   81,  262,  306,   84,  301,   30,
+  264,  265,  172,   34,  174,  299,  300,  301,  157,  158,
+  297,  181,  306,  162,  184,  164,  186,  264,  265,  189,
+  190,  306,  259,  260,  290,  291,  292,  287,  252,  301,
+  296,  297,  256,  306,  267,  268,  269,  270,  271,  272,
+  273,  295,  212,  213,  214,  215,  259,  260,  264,  265,
+  287,  288,  289,  266,  232,  325,  293,  299,  300,  301,
+  232,  298,  299,  300,  301,  298,  303,  304,  305,  306,
+  157,  308,  309,  310,  259,  260,  313,  314,  315,  316,
+  317,  318,  259,  260,  261,  257,  320,  257,  263,  263,
+  302,  259,  260,  263,  264,  265,  264,  265,  266,  263,
+  131,  132,  133,  134,  135,  278,  137,  302,  278,  265,
+  306,  259,  260,  261,  302,  285,  264,  265,  266,  259,
+  260,  261,  265,  293,  259,  260,  274,  275,  276,  299,
+  263,  301,  302,  265,  302,  259,  260,  266,  256,  301,
+  264,  265,  266,  261,  288,  289,  290,  291,  292,  306,
+  302,  300,  296,  297,  302,  306,  334,  259,  260,  261,
+  306,  306,  334,  333,  298,  315,  315,  306,  263,  287,
+  288,  289,  302,  315,  302,  293,  302,  347,  302,  302,
+  298,  299,  300,  301,  257,  303,  304,  305,  306,  302,
+  308,  309,  310,  342,  343,  313,  314,  315,  316,  317,
+  318,  256,  302,  278,  259,  260,  261,  262,  190,  327,
+  328,   27,   -1,   -1,  274,  333,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,  280,  281,  282,  283,
+  284,  285,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
+   -1,   -1,  302,  298,  299,  300,  301,   -1,  303,  304,
+  305,  306,   -1,  308,  309,  310,  311,  312,  313,  314,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+   -1,  326,   -1,   -1,  329,  330,  331,  332,  256,   -1,
    -1,  259,  260,  261,  262,   -1,  259,  260,  261,   -1,
-   -1,  264,  265,  266,  280,  281,  282,  283,  284,  285,
-   -1,  274,  275,  276,  277,  278,  279,   -1,   -1,  287,
+   -1,  264,  265,  266,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  274,  275,  276,  277,   -1,   -1,   -1,   -1,  287,
   288,  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,
   298,  299,  300,  301,   -1,  303,  304,  305,  306,  302,
   308,  309,  310,  311,  312,  313,  314,  315,  316,  317,
-  318,  319,  320,  321,  322,   -1,  324,   -1,   -1,  327,
-  328,  329,  330,  256,   -1,   -1,  259,  260,  261,   -1,
-   -1,  259,  260,  261,   -1,   -1,  264,  265,  266,  278,
-  279,  280,  281,  282,  283,  284,  285,  275,   -1,   -1,
-   -1,   -1,   -1,   -1,  287,  288,  289,   -1,   -1,   -1,
-  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
-  303,  304,  305,  306,  302,  308,  309,  310,  311,  312,
-  313,  314,  315,  316,  317,  318,  319,  320,  321,  322,
-   -1,  324,   -1,   -1,  327,  328,  329,  330,  256,   -1,
-   -1,  259,  260,  261,   -1,   -1,  259,  260,  261,   -1,
-   -1,  264,  265,  266,   -1,  267,  268,  269,  270,  271,
-  272,  273,  275,   -1,   -1,   -1,   -1,   -1,   -1,  287,
-  288,  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,
-  298,  299,  300,  301,   -1,  303,  304,  305,  306,  302,
-  308,  309,  310,  311,  312,  313,  314,  315,  316,  317,
-  318,  319,  320,  321,  322,   -1,  324,   -1,   -1,  327,
-  328,  329,  330,  259,  260,  261,   -1,  263,  264,  265,
-  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
-  296,  297,  298,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,  263,  264,  265,  266,  267,
-  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,  295,  296,  297,
-  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
+  318,  319,  320,  321,  322,  323,  324,   -1,  326,   -1,
+   -1,  329,  330,  331,  332,  256,   -1,   -1,  259,  260,
+  261,   -1,   -1,  259,  260,  261,   -1,   -1,  264,  265,
+  266,  278,  279,  280,  281,  282,  283,  284,  285,  275,
+   -1,   -1,   -1,   -1,   -1,   -1,  287,  288,  289,   -1,
+   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
+  301,   -1,  303,  304,  305,  306,  302,  308,  309,  310,
+  311,  312,  313,  314,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,   -1,  326,   -1,   -1,  329,  330,
+  331,  332,  256,   -1,   -1,  259,  260,  261,   -1,   -1,
+  259,  260,  261,   -1,   -1,  264,  265,  266,   -1,  267,
+  268,  269,  270,  271,  272,  273,  275,   -1,   -1,   -1,
+   -1,   -1,   -1,  287,  288,  289,   -1,   -1,   -1,  293,
+   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,
+  304,  305,  306,  302,  308,  309,  310,  311,  312,  313,
+  314,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,   -1,  326,   -1,   -1,  329,  330,  331,  332,  259,
+  260,  261,   -1,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,  296,  297,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,  296,  297,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
   260,  261,   -1,  263,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
   290,  291,  292,  293,   -1,  295,  296,  297,   -1,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
-   -1,  263,  264,  265,  266,  267,  268,  269,  270,  271,
-  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,   -1,  296,  297,   -1,  299,  300,  301,
-  302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
-  264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
-  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
-   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
-  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
-  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
-  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
-  296,  297,   -1,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
-  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,   -1,  296,  297,   -1,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,  296,  297,   -1,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,   -1,  296,  297,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
   260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
   290,  291,  292,  293,   -1,  295,  296,   -1,  298,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
-   -1,   -1,  264,  265,  266,  267,  268,  269,  270,  271,
-  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,  295,  296,  297,   -1,  299,  300,  301,
-  302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
-  264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
-  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
-   -1,  295,   -1,   -1,  298,  299,  300,  301,  302,  303,
-  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
-  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
-  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
-   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
-  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,  295,   -1,   -1,
-  298,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,  296,  297,   -1,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
   260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
   290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
-   -1,   -1,  264,  265,  266,  267,  268,  269,  270,  271,
-  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,  295,   -1,   -1,  298,  299,  300,  301,
-  302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
-  264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
-  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,  287,  288,  289,  290,  291,  292,  293,
-   -1,  295,   -1,   -1,  298,  299,  300,  301,  302,  303,
-  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
-  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
-  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,  290,  291,  292,  293,   -1,  295,
-   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,  267,
-  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-   -1,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,   -1,  296,  297,   -1,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
   260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
   270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
   290,  291,  292,  293,   -1,  295,  296,  297,  298,   -1,
    -1,   -1,  302,  303,  304,  305,   -1,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
-   -1,   -1,  264,  265,  266,  267,  268,  269,  270,  271,
-  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,  288,  289,  290,  291,
-  292,  293,   -1,   -1,  296,  297,  298,   -1,   -1,   -1,
-  302,  303,  304,  305,   -1,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  259,  260,  261,   -1,   -1,
-  264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
-  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,  287,  288,  289,   -1,   -1,   -1,  293,
-   -1,  295,   -1,   -1,  298,  299,  300,  301,  302,  303,
-  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,
-  314,  315,  316,  259,  260,  261,   -1,   -1,  264,  265,
-  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
-  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-   -1,  287,  288,  289,   -1,   -1,   -1,  293,   -1,  295,
-   -1,   -1,  298,  299,  300,  301,  302,  303,  304,  305,
-  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,
-  316,  259,  260,  261,   -1,   -1,  264,  265,  266,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,   -1,  287,
-  288,  289,  290,  291,  292,  293,   -1,   -1,  296,  297,
-   -1,  299,  300,  301,  302,  303,  304,  305,  306,   -1,
-  308,  309,  310,   -1,   -1,  313,  314,  315,  316,  259,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,   -1,  296,  297,  298,   -1,
+   -1,   -1,  302,  303,  304,  305,   -1,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+   -1,   -1,   -1,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,  267,  268,  269,
+  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+   -1,   -1,   -1,  293,   -1,  295,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,  288,  289,
+  290,  291,  292,  293,   -1,   -1,  296,  297,   -1,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
   260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,   -1,
    -1,   -1,   -1,   -1,  274,  275,  276,  277,  278,  279,
   280,  281,  282,  283,  284,  285,   -1,  287,   -1,   -1,
    -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,
   300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
-  310,   -1,   -1,  313,  314,  315,  316,  259,  260,  261,
-   -1,   -1,  264,  265,  266,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  274,  275,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,   -1,  287,   -1,   -1,   -1,   -1,
-   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,
-  302,  303,  304,  305,  306,   -1,  308,  309,  310,   -1,
-   -1,  313,  314,  315,  316,  260,   -1,   -1,  263,   -1,
-   -1,   -1,  267,  268,  269,  270,  271,  272,  273,  274,
-   -1,  276,  277,   -1,  279,  280,  281,  282,  283,  284,
-  285,   -1,  287,  288,  289,  290,  291,  292,  293,  260,
-   -1,  296,  297,   -1,  299,  300,  301,   -1,  303,  304,
-  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
-  315,  316,   -1,   -1,   -1,   -1,  287,  288,  289,  260,
-   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
-  301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  287,  288,  289,   -1,
-   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
-  301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  263,   -1,   -1,   -1,
-  267,  268,  269,  270,  271,  272,  273,  274,   -1,  276,
-  277,  278,  279,  280,  281,  282,  283,  284,  285,   -1,
-  287,  288,  289,  290,  291,  292,  293,   -1,   -1,  296,
-  297,   -1,  299,  300,  301,   -1,  303,  304,  305,  306,
-   -1,  308,  309,  310,  265,   -1,  313,  314,  315,  316,
-   -1,   -1,   -1,  274,   -1,  276,  277,  278,  279,  280,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  259,
+  260,  261,   -1,   -1,  264,  265,  266,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  274,  275,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,   -1,  287,   -1,   -1,
+   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,
+  300,  301,  302,  303,  304,  305,  306,   -1,  308,  309,
+  310,   -1,   -1,  313,  314,  315,  316,  317,  318,  260,
+   -1,   -1,  263,   -1,   -1,   -1,  267,  268,  269,  270,
+  271,  272,  273,  274,   -1,  276,  277,   -1,  279,  280,
   281,  282,  283,  284,  285,   -1,  287,  288,  289,  290,
-  291,  292,  293,   -1,   -1,  296,  297,   -1,  299,  300,
+  291,  292,  293,  260,   -1,  296,  297,   -1,  299,  300,
   301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
-   -1,   -1,  313,  314,  315,  316,  259,  260,  261,   -1,
-   -1,  264,  265,  266,  259,  260,  261,   -1,   -1,  264,
-  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,   -1,
+   -1,   -1,  313,  314,  315,  316,  317,  318,   -1,   -1,
+  287,  288,  289,   -1,   -1,  260,  293,   -1,   -1,   -1,
+   -1,  298,  299,  300,  301,   -1,  303,  304,  305,  306,
+   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,  316,
+  317,  318,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
+   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,
+  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
+  315,  316,  317,  318,  263,   -1,   -1,   -1,  267,  268,
+  269,  270,  271,  272,  273,  274,   -1,  276,  277,  278,
+  279,  280,  281,  282,  283,  284,  285,   -1,  287,  288,
+  289,  290,  291,  292,  293,   -1,   -1,  296,  297,   -1,
+  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
+  309,  310,  265,   -1,  313,  314,  315,  316,  317,  318,
+   -1,  274,   -1,  276,  277,  278,  279,  280,  281,  282,
+  283,  284,  285,   -1,  287,  288,  289,  290,  291,  292,
+  293,   -1,   -1,  296,  297,   -1,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  317,  318,  259,  260,  261,   -1,
+   -1,  264,  265,  266,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  274,  275,  276,  277,  278,  279,  280,  281,  282,
+  283,  284,  285,   -1,  259,  260,  261,   -1,   -1,  264,
+  265,  266,   -1,   -1,   -1,   -1,  259,  260,  261,  302,
   275,  264,  265,  266,  259,  260,  261,   -1,   -1,  264,
+  265,  266,  275,   -1,   -1,   -1,  259,  260,  261,   -1,
+  275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
   265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
   275,  264,  265,  266,  259,  260,  261,  302,   -1,  264,
   265,  266,  275,   -1,   -1,   -1,  259,  260,  261,  302,
@@ -1006,59 +1058,62 @@ static const YYINT yycheck[] = {                          7,
    -1,   -1,   -1,   -1,  265,   -1,   -1,  302,   -1,   -1,
    -1,   -1,   -1,  274,  302,  276,  277,  278,  279,  280,
   281,  282,  283,  284,  285,   -1,   -1,   -1,   -1,   -1,
-   -1,  265,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  265,  267,  268,  269,  270,  271,  272,  273,   -1,
   274,  302,  276,  277,  278,  279,  280,  281,  282,  283,
   284,  285,   -1,   -1,   -1,   -1,   -1,   -1,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,  302,  298,
+  289,   -1,   -1,  298,  293,   -1,   -1,  302,  302,  298,
   299,  300,  301,   -1,  303,  304,  305,  306,  307,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,  302,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,  302,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,  302,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
-  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
-  299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  287,  288,
+  309,  310,   -1,   -1,  313,  314,  315,  316,  317,  318,
+  287,  288,  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,
+   -1,  298,  299,  300,  301,  302,  303,  304,  305,  306,
+   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,  316,
+  317,  318,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
+   -1,   -1,   -1,  298,  299,  300,  301,  302,  303,  304,
+  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
+  315,  316,  317,  318,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,  302,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  317,  318,  287,  288,  289,   -1,
+   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,  299,  300,
+  301,   -1,  303,  304,  305,  306,   -1,  308,  309,  310,
+   -1,   -1,  313,  314,  315,  316,  317,  318,  287,  288,
   289,   -1,   -1,   -1,  293,   -1,   -1,   -1,   -1,  298,
   299,  300,  301,   -1,  303,  304,  305,  306,   -1,  308,
-  309,  310,   -1,   -1,  313,  314,  315,  316,  274,   -1,
+  309,  310,   -1,   -1,  313,  314,  315,  316,  317,  318,
+  287,  288,  289,   -1,   -1,   -1,  293,   -1,   -1,   -1,
+   -1,  298,  299,  300,  301,   -1,  303,  304,  305,  306,
+   -1,  308,  309,  310,   -1,   -1,  313,  314,  315,  316,
+  317,  318,  287,  288,  289,   -1,   -1,   -1,  293,   -1,
+   -1,   -1,   -1,  298,  299,  300,  301,   -1,  303,  304,
+  305,  306,   -1,  308,  309,  310,   -1,   -1,  313,  314,
+  315,  316,  317,  318,  287,  288,  289,   -1,   -1,   -1,
+  293,   -1,   -1,   -1,   -1,  298,  299,  300,  301,   -1,
+  303,  304,  305,  306,   -1,  308,  309,  310,   -1,   -1,
+  313,  314,  315,  316,  317,  318,  274,   -1,  276,  277,
+  278,  279,  280,  281,  282,  283,  284,  285,  274,   -1,
   276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-  274,   -1,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,   -1,   -1,   -1,  274,  302,  276,  277,  278,
-  279,  280,  281,  282,  283,  284,  285,  274,  302,  276,
-  277,  278,  279,  280,  281,  282,  283,  284,  285,   -1,
-   -1,   -1,  274,  302,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,  274,  302,  276,  277,  278,  279,
-  280,  281,  282,  283,  284,  285,  259,  260,   -1,  274,
-  302,  276,  277,  278,  279,  280,  281,  282,  283,  284,
-  285,  274,  302,  276,  277,  278,  279,  280,  281,  282,
-  283,  284,  285,  260,   -1,   -1,   -1,  302,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,  260,   -1,  274,   -1,  276,
+   -1,   -1,   -1,  274,  302,  276,  277,  278,  279,  280,
+  281,  282,  283,  284,  285,  274,  302,  276,  277,  278,
+  279,  280,  281,  282,  283,  284,  285,   -1,   -1,   -1,
+  274,  302,  276,  277,  278,  279,  280,  281,  282,  283,
+  284,  285,  274,  302,  276,  277,  278,  279,  280,  281,
+  282,  283,  284,  285,  259,  260,   -1,  274,  302,  276,
   277,  278,  279,  280,  281,  282,  283,  284,  285,  274,
+  302,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+  285,  260,   -1,   -1,   -1,  302,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  260,   -1,  274,   -1,  276,  277,  278,
+  279,  280,  281,  282,  283,  284,  285,  274,   -1,  276,
+  277,  278,  279,  280,  281,  282,  283,  284,  285,  265,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,   -1,
+  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
+  265,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,
    -1,  276,  277,  278,  279,  280,  281,  282,  283,  284,
   285,  265,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
   274,   -1,  276,  277,  278,  279,  280,  281,  282,  283,
-  284,  285,  265,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,  274,   -1,  276,  277,  278,  279,  280,  281,  282,
-  283,  284,  285,  265,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,  274,   -1,  276,  277,  278,  279,  280,  281,
-  282,  283,  284,  285,  274,  275,  276,  277,  278,  279,
-  280,  281,  282,  283,  284,  285,  274,   -1,  276,  277,
-  278,  279,  280,  281,  282,  283,  284,  285,
+  284,  285,  274,  275,  276,  277,  278,  279,  280,  281,
+  282,  283,  284,  285,  274,   -1,  276,  277,  278,  279,
+  280,  281,  282,  283,  284,  285,  277,  278,  279,  280,
+  281,  282,  283,  284,  285,
 };
 #if YYBTYACC
 static const YYINT yyctable[] = {                        -1,
@@ -1360,15 +1415,28 @@ static const YYINT yyctable[] = {                        -1,
    -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
    -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
    -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
-   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,
 };
 #endif
-#define YYFINAL 25
+#define YYFINAL 27
 #ifndef YYDEBUG
 #define YYDEBUG 0
 #endif
-#define YYMAXTOKEN 331
-#define YYUNDFTOKEN 389
+#define YYMAXTOKEN 333
+#define YYUNDFTOKEN 395
 #define YYTRANSLATE(a) ((a) > YYMAXTOKEN ? YYUNDFTOKEN : (a))
 #if YYDEBUG
 #ifndef NULL
@@ -1398,16 +1466,17 @@ NULL,"error","UNEXPECTED","BAD_DECIMAL","NL","SEMI_COLON","LBRACE","RBRACE",
 "LTE","GT","GTE","CAT","GETLINE","PLUS","MINUS","MUL","DIV","MOD","NOT",
 "UMINUS","IO_IN","PIPE","POW","INC_or_DEC","DOLLAR","FIELD","LPAREN","RPAREN",
 "DOUBLE","STRING_","RE","ID","D_ID","FUNCT_ID","BUILTIN","LENGTH","PRINT",
-"PRINTF","SPLIT","MATCH_FUNC","SUB","GSUB","DO","WHILE","FOR","BREAK",
-"CONTINUE","IF","ELSE","DELETE","BEGIN","END","EXIT","NEXT","NEXTFILE","RETURN",
-"FUNCTION","$accept","program","block","block_or_separator","statement_list",
-"statement","mark","pr_args","arg2","builtin","getline_file","lvalue","field",
-"fvalue","expr","cat_expr","p_expr","while_front","if_front","for1","for2",
-"array_loop_front","return_statement","split_front","re_arg","sub_back",
-"arglist","args","print","sub_or_gsub","funct_start","funct_head","call_args",
-"ca_front","ca_back","f_arglist","f_args","program_block","PA_block",
-"function_def","outside_error","$$1","$$2","$$3","$$4","$$5","separator","$$6",
-"$$7","$$8","$$9","pr_direction","else_back","do","for3","split_back","getline",
+"PRINTF","SPLIT","MATCH_FUNC","SUB","GSUB","ASORT","ASORTI","DO","WHILE","FOR",
+"BREAK","CONTINUE","IF","ELSE","DELETE","BEGIN","END","EXIT","NEXT","NEXTFILE",
+"RETURN","FUNCTION","$accept","program","block","block_or_separator",
+"statement_list","statement","mark","pr_args","arg2","builtin","getline_file",
+"lvalue","field","fvalue","expr","cat_expr","p_expr","while_front","if_front",
+"for1","for2","array_loop_front","return_statement","split_front","re_arg",
+"sub_back","arglist","args","sort_back","print","sub_or_gsub","sort_func",
+"funct_start","funct_head","call_args","ca_front","ca_back","f_arglist",
+"f_args","program_block","PA_block","function_def","outside_error","$$1","$$2",
+"$$3","$$4","$$5","separator","$$6","$$7","$$8","$$9","pr_direction",
+"else_back","do","for3","split_back","$$10","sort_dest","getline",
 "illegal-symbol",
 };
 static const char *const yyrule[] = {
@@ -1545,6 +1614,14 @@ static const char *const yyrule[] = {
 "split_front : SPLIT LPAREN expr COMMA ID",
 "split_back : RPAREN",
 "split_back : COMMA expr RPAREN",
+"$$10 :",
+"p_expr : sort_func mark LPAREN ID $$10 sort_back",
+"sort_func : ASORT",
+"sort_func : ASORTI",
+"sort_back : RPAREN",
+"sort_back : sort_dest RPAREN",
+"sort_back : sort_dest COMMA expr RPAREN",
+"sort_dest : COMMA ID",
 "p_expr : LENGTH LPAREN RPAREN",
 "p_expr : LENGTH LPAREN expr RPAREN",
 "p_expr : LENGTH LPAREN ID RPAREN",
@@ -1718,7 +1795,7 @@ static YYINT  *yylexp = NULL;
 
 static YYINT  *yylexemes = NULL;
 #endif /* YYBTYACC */
-#line 1197 "parse.y"
+#line 1257 "parse.y"
 
 /*
  * Check for special case where there is a forward reference to a newly
@@ -1831,6 +1908,214 @@ resize_fblock(FBLOCK * fbp)
 	add_to_fdump_list(fbp);
 }
 
+/* Constant folding.  The operands of an operator are the last
+   instructions coded; if they are constants, the operator is applied
+   now instead of each time the code is executed.  Only numbers are
+   folded that the run-time code could not have reported as an error.
+*/
+
+#define is_pushd(p)  ((p)->op == _PUSHD)
+#define pushd_value(p)  (*(double *) (p)[1].ptr)
+#define is_finite(d)  (!isinf(d) && !isnan(d))
+
+static void
+replace_pushd(INST * p, double d)
+{
+    double *dp;
+
+    if (p[1].ptr != (PTR) & double_zero && p[1].ptr != (PTR) & double_one)
+	dp = (double *) p[1].ptr;
+    else
+	dp = ZMALLOC(double);
+    *dp = d;
+    p[1].ptr = (PTR) dp;
+}
+
+static void
+free_pushd(INST * p)
+{
+    if (p[1].ptr != (PTR) & double_zero && p[1].ptr != (PTR) & double_one)
+	ZFREE((double *) p[1].ptr);
+}
+
+static void
+code_binary(int op, int left, int right)
+{
+    INST *p1 = CDP(left);
+    INST *p2 = CDP(right);
+    double x, y, z = 0.0;
+    int fold = 1;
+
+    if (p1 + 2 != p2 || p2 + 2 != code_ptr ||
+	!is_pushd(p1) || !is_pushd(p2)) {
+	code1(op);
+	return;
+    }
+
+    x = pushd_value(p1);
+    y = pushd_value(p2);
+    if (!is_finite(x) || !is_finite(y)) {
+	code1(op);
+	return;
+    }
+
+    switch (op) {
+    case _ADD:
+	z = x + y;
+	break;
+    case _SUB:
+	z = x - y;
+	break;
+    case _MUL:
+	z = x * y;
+	break;
+    case _DIV:
+	if ((fold = (y != 0.0)))
+	    z = x / y;
+	break;
+    case _MOD:
+	if ((fold = (y != 0.0)))
+	    z = fmod(x, y);
+	break;
+    case _POW:
+	z = pow(x, y);
+	break;
+    case _EQ:
+	z = (x == y);
+	break;
+    case _NEQ:
+	z = (x != y);
+	break;
+    case _LT:
+	z = (x < y);
+	break;
+    case _LTE:
+	z = (x <= y);
+	break;
+    case _GT:
+	z = (x > y);
+	break;
+    default:			/* _GTE */
+	z = (x >= y);
+	break;
+    }
+
+    /* leave division by zero, overflow, etc., to the run-time checks */
+    if (!fold || !is_finite(z)) {
+	code1(op);
+	return;
+    }
+
+    replace_pushd(p1, z);
+    free_pushd(p2);
+    code_ptr = p2;
+}
+
+static void
+code_unary(int op, int operand)
+{
+    INST *p = CDP(operand);
+
+    if (p + 2 != code_ptr || !is_pushd(p)) {
+	code1(op);
+    } else if (op == _UMINUS) {
+	replace_pushd(p, -pushd_value(p));
+    } else if (op == _NOT) {
+	replace_pushd(p, pushd_value(p) != 0.0 ? 0.0 : 1.0);
+    }
+    /* unary plus of a number does nothing */
+}
+
+/* "a" "b" is coded as the one string "ab".  Numbers are not folded,
+   since their conversion depends on CONVFMT when the code runs.
+*/
+static void
+code_cat(int left, int right)
+{
+    INST *p1 = CDP(left);
+    INST *p2 = CDP(right);
+
+    if (p1 + 2 == p2 && p2 + 2 == code_ptr &&
+	p1->op == _PUSHS && p2->op == _PUSHS) {
+	STRING *s1 = (STRING *) p1[1].ptr;
+	STRING *s2 = (STRING *) p2[1].ptr;
+	STRING *b = new_STRING0(SizePlus(s1->len, s2->len));
+
+	memcpy(b->str, s1->str, s1->len);
+	memcpy(b->str + s1->len, s2->str, s2->len);
+	free_STRING(s1);
+	free_STRING(s2);
+	p1[1].ptr = (PTR) b;
+	code_ptr = p2;
+    } else {
+	code1(_CAT);
+    }
+}
+
+/* Dead code.  An if statement whose test is a false constant jumps
+   around its body, which drop_if_false() then discards.  The
+   statements following a next, nextfile, exit or return in the same
+   statement list are discarded by list_statement().  Code is only
+   discarded if nothing refers to it, see code_discardable().
+*/
+
+static void
+code_if_test(int test)
+{
+    if (CDP(test) == code_ptr - 2 && is_pushd(code_ptr - 2) &&
+	pushd_value(code_ptr - 2) == 0.0) {
+	free_pushd(code_ptr - 2);
+	code_ptr -= 2;
+	code_jmp(_JMP, (INST *) 0);
+    } else {
+	code_jmp(_JZ, (INST *) 0);
+    }
+}
+
+/* discard the code of an if statement from its start up to the else
+   part (or the end), moving the else part down to start */
+static void
+drop_if_false(int start, int else_part)
+{
+    INST *p = CDP(start);
+
+    /* an expression never starts with _JMP, see code_if_test() */
+    if (p->op == _JMP && code_discardable(p, scope, active_funct)) {
+	INST *q = CDP(else_part);
+	size_t len = (size_t) (code_ptr - q);
+
+	code_discard(p, q);
+	if (len)
+	    memmove(p, q, INST_BYTES(len));
+	code_ptr = p + len;
+	if (dead_offset > start)
+	    dead_list = -1;
+    }
+}
+
+static void
+leave_statement(int start)
+{
+    leave_start = start;
+    leave_end = code_offset;
+}
+
+static void
+list_statement(int list, int stmt)
+{
+    if (list == dead_list && stmt == dead_offset) {
+	if (code_discardable(CDP(stmt), scope, active_funct)) {
+	    code_discard(CDP(stmt), code_ptr);
+	    code_ptr = CDP(stmt);
+	}
+    } else if (dead_list < 0 &&
+	       stmt == leave_start && code_offset == leave_end) {
+	dead_list = list;
+	dead_offset = code_offset;
+    }
+    leave_start = -1;
+}
+
 /* convert FE_PUSHA  to  FE_PUSHI
    or F_PUSH to F_PUSHI
 */
@@ -2034,12 +2319,16 @@ parse(void)
 
     if (compile_error_count != 0)
 	mawk_exit(2);
+    code_inline();
+    code_hoist();
+    code_fuse();
+    code_specialize();
     if (dump_code_flag) {
 	dump_code();
 	mawk_exit(0);
     }
 }
-#line 2042 "parse.c"
+#line 2331 "parse.c"
 
 /* For use in generated program */
 #define yydepth (int)(yystack.s_mark - yystack.s_base)
@@ -2710,44 +2999,44 @@ yyreduce:
     switch (yyn)
     {
 case 6:
-#line 167 "parse.y"
+#line 182 "parse.y"
 	{ /* this do nothing action removes a vacuous warning
                   from Bison */
              }
-#line 2717 "parse.c"
+#line 3006 "parse.c"
 break;
 case 7:
-#line 172 "parse.y"
+#line 187 "parse.y"
 	{ scope = SCOPE_BEGIN ; be_setup(scope) ; }
-#line 2722 "parse.c"
+#line 3011 "parse.c"
 break;
 case 8:
-#line 175 "parse.y"
+#line 190 "parse.y"
 	{ switch_code_to_main() ; }
-#line 2727 "parse.c"
+#line 3016 "parse.c"
 break;
 case 9:
-#line 178 "parse.y"
+#line 193 "parse.y"
 	{ scope = SCOPE_END ; be_setup(scope) ; }
-#line 2732 "parse.c"
+#line 3021 "parse.c"
 break;
 case 10:
-#line 181 "parse.y"
+#line 196 "parse.y"
 	{ switch_code_to_main() ; }
-#line 2737 "parse.c"
+#line 3026 "parse.c"
 break;
 case 11:
-#line 184 "parse.y"
+#line 199 "parse.y"
 	{ code_jmp(_JZ, (INST*)0) ; }
-#line 2742 "parse.c"
+#line 3031 "parse.c"
 break;
 case 12:
-#line 187 "parse.y"
+#line 202 "parse.y"
 	{ patch_jmp( code_ptr ) ; }
-#line 2747 "parse.c"
+#line 3036 "parse.c"
 break;
 case 13:
-#line 191 "parse.y"
+#line 206 "parse.y"
 	{
                INST *p1 = CDP(yystack.l_mark[-1].start) ;
              int len ;
@@ -2763,166 +3052,182 @@ case 13:
              p1 = CDP(yystack.l_mark[-1].start) ;
                p1[2].op = CodeOffset(p1 + 1) ;
              }
-#line 2766 "parse.c"
+#line 3055 "parse.c"
 break;
 case 14:
-#line 207 "parse.y"
+#line 222 "parse.y"
 	{ code1(_STOP) ; }
-#line 2771 "parse.c"
+#line 3060 "parse.c"
 break;
 case 15:
-#line 210 "parse.y"
+#line 225 "parse.y"
 	{
                INST *p1 = CDP(yystack.l_mark[-5].start) ;
 
                p1[3].op = (int) (CDP(yystack.l_mark[0].start) - (p1 + 1)) ;
                p1[4].op = CodeOffset(p1 + 1) ;
              }
-#line 2781 "parse.c"
+#line 3070 "parse.c"
 break;
 case 16:
-#line 221 "parse.y"
-	{ yyval.start = yystack.l_mark[-1].start ; }
-#line 2786 "parse.c"
+#line 236 "parse.y"
+	{ yyval.start = yystack.l_mark[-1].start ;
+              if ( dead_list == yystack.l_mark[-1].start ) dead_list = -1 ;
+            }
+#line 3077 "parse.c"
 break;
 case 17:
-#line 223 "parse.y"
+#line 240 "parse.y"
 	{ yyval.start = code_offset ; /* does nothing won't be executed */
               print_flag = getline_flag = paren_cnt = 0 ;
               yyerrok ; }
-#line 2793 "parse.c"
+#line 3084 "parse.c"
 break;
 case 19:
-#line 230 "parse.y"
+#line 247 "parse.y"
 	{ yyval.start = code_offset ;
                        code1(_PUSHINT) ; code1(0) ;
                        func2(_PRINT, bi_print) ;
                      }
-#line 2801 "parse.c"
+#line 3092 "parse.c"
+break;
+case 20:
+#line 254 "parse.y"
+	{ list_statement(yystack.l_mark[0].start, yystack.l_mark[0].start) ; }
+#line 3097 "parse.c"
+break;
+case 21:
+#line 256 "parse.y"
+	{ list_statement(yystack.l_mark[-1].start, yystack.l_mark[0].start) ; }
+#line 3102 "parse.c"
 break;
 case 23:
-#line 243 "parse.y"
+#line 262 "parse.y"
 	{ code1(_POP) ; }
-#line 2806 "parse.c"
+#line 3107 "parse.c"
 break;
 case 24:
-#line 245 "parse.y"
+#line 264 "parse.y"
 	{ yyval.start = code_offset ; }
-#line 2811 "parse.c"
+#line 3112 "parse.c"
 break;
 case 25:
-#line 247 "parse.y"
+#line 266 "parse.y"
 	{ yyval.start = code_offset ;
                 print_flag = getline_flag = 0 ;
                 paren_cnt = 0 ;
                 yyerrok ;
               }
-#line 2820 "parse.c"
+#line 3121 "parse.c"
 break;
 case 26:
-#line 253 "parse.y"
+#line 272 "parse.y"
 	{ yyval.start = code_offset ; BC_insert('B', code_ptr+1) ;
-               code2(_JMP, 0) /* don't use code_jmp ! */ ; }
-#line 2826 "parse.c"
+               code2(_JMP, 0) /* don't use code_jmp ! */ ;
+               leave_statement(yyval.start) ; }
+#line 3128 "parse.c"
 break;
 case 27:
-#line 256 "parse.y"
+#line 276 "parse.y"
 	{ yyval.start = code_offset ; BC_insert('C', code_ptr+1) ;
-               code2(_JMP, 0) ; }
-#line 2832 "parse.c"
+               code2(_JMP, 0) ;
+               leave_statement(yyval.start) ; }
+#line 3135 "parse.c"
 break;
 case 28:
-#line 259 "parse.y"
+#line 280 "parse.y"
 	{ if ( scope != SCOPE_FUNCT )
                      compile_error("return outside function body") ;
              }
-#line 2839 "parse.c"
+#line 3142 "parse.c"
 break;
 case 29:
-#line 263 "parse.y"
+#line 284 "parse.y"
 	{ if ( scope != SCOPE_MAIN )
                    compile_error( "improper use of next" ) ;
                 yyval.start = code_offset ;
                 code1(_NEXT) ;
+                leave_statement(yyval.start) ;
               }
-#line 2848 "parse.c"
+#line 3152 "parse.c"
 break;
 case 30:
-#line 269 "parse.y"
+#line 291 "parse.y"
 	{ if ( scope != SCOPE_MAIN )
                    compile_error( "improper use of nextfile" ) ;
                 yyval.start = code_offset ;
                 code1(_NEXTFILE) ;
+                leave_statement(yyval.start) ;
               }
-#line 2857 "parse.c"
+#line 3162 "parse.c"
 break;
 case 34:
-#line 280 "parse.y"
+#line 303 "parse.y"
 	{ code1(_ASSIGN) ; }
-#line 2862 "parse.c"
+#line 3167 "parse.c"
 break;
 case 35:
-#line 281 "parse.y"
+#line 304 "parse.y"
 	{ code1(_ADD_ASG) ; }
-#line 2867 "parse.c"
+#line 3172 "parse.c"
 break;
 case 36:
-#line 282 "parse.y"
+#line 305 "parse.y"
 	{ code1(_SUB_ASG) ; }
-#line 2872 "parse.c"
+#line 3177 "parse.c"
 break;
 case 37:
-#line 283 "parse.y"
+#line 306 "parse.y"
 	{ code1(_MUL_ASG) ; }
-#line 2877 "parse.c"
+#line 3182 "parse.c"
 break;
 case 38:
-#line 284 "parse.y"
+#line 307 "parse.y"
 	{ code1(_DIV_ASG) ; }
-#line 2882 "parse.c"
+#line 3187 "parse.c"
 break;
 case 39:
-#line 285 "parse.y"
+#line 308 "parse.y"
 	{ code1(_MOD_ASG) ; }
-#line 2887 "parse.c"
+#line 3192 "parse.c"
 break;
 case 40:
-#line 286 "parse.y"
+#line 309 "parse.y"
 	{ code1(_POW_ASG) ; }
-#line 2892 "parse.c"
+#line 3197 "parse.c"
 break;
 case 41:
-#line 287 "parse.y"
-	{ code1(_EQ) ; }
-#line 2897 "parse.c"
+#line 310 "parse.y"
+	{ code_binary(_EQ, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3202 "parse.c"
 break;
 case 42:
-#line 288 "parse.y"
-	{ code1(_NEQ) ; }
-#line 2902 "parse.c"
+#line 311 "parse.y"
+	{ code_binary(_NEQ, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3207 "parse.c"
 break;
 case 43:
-#line 289 "parse.y"
-	{ code1(_LT) ; }
-#line 2907 "parse.c"
+#line 312 "parse.y"
+	{ code_binary(_LT, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3212 "parse.c"
 break;
 case 44:
-#line 290 "parse.y"
-	{ code1(_LTE) ; }
-#line 2912 "parse.c"
+#line 313 "parse.y"
+	{ code_binary(_LTE, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3217 "parse.c"
 break;
 case 45:
-#line 291 "parse.y"
-	{ code1(_GT) ; }
-#line 2917 "parse.c"
+#line 314 "parse.y"
+	{ code_binary(_GT, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3222 "parse.c"
 break;
 case 46:
-#line 292 "parse.y"
-	{ code1(_GTE) ; }
-#line 2922 "parse.c"
+#line 315 "parse.y"
+	{ code_binary(_GTE, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3227 "parse.c"
 break;
 case 47:
-#line 295 "parse.y"
+#line 318 "parse.y"
 	{
             INST *p3 = CDP(yystack.l_mark[0].start) ;
 
@@ -2948,132 +3253,132 @@ case 47:
 
             if ( !yystack.l_mark[-1].ival ) code1(_NOT) ;
           }
-#line 2951 "parse.c"
+#line 3256 "parse.c"
 break;
 case 48:
-#line 323 "parse.y"
+#line 346 "parse.y"
 	{ code1(_TEST) ;
                 code_jmp(_LJNZ, (INST*)0) ;
               }
-#line 2958 "parse.c"
+#line 3263 "parse.c"
 break;
 case 49:
-#line 327 "parse.y"
+#line 350 "parse.y"
 	{ code1(_TEST) ; patch_jmp(code_ptr) ; }
-#line 2963 "parse.c"
+#line 3268 "parse.c"
 break;
 case 50:
-#line 330 "parse.y"
+#line 353 "parse.y"
 	{ code1(_TEST) ;
                 code_jmp(_LJZ, (INST*)0) ;
               }
-#line 2970 "parse.c"
+#line 3275 "parse.c"
 break;
 case 51:
-#line 334 "parse.y"
+#line 357 "parse.y"
 	{ code1(_TEST) ; patch_jmp(code_ptr) ; }
-#line 2975 "parse.c"
+#line 3280 "parse.c"
 break;
 case 52:
-#line 336 "parse.y"
+#line 359 "parse.y"
 	{ code_jmp(_JZ, (INST*)0) ; }
-#line 2980 "parse.c"
+#line 3285 "parse.c"
 break;
 case 53:
-#line 337 "parse.y"
+#line 360 "parse.y"
 	{ code_jmp(_JMP, (INST*)0) ; }
-#line 2985 "parse.c"
+#line 3290 "parse.c"
 break;
 case 54:
-#line 339 "parse.y"
+#line 362 "parse.y"
 	{ patch_jmp(code_ptr) ; patch_jmp(CDP(yystack.l_mark[0].start)) ; }
-#line 2990 "parse.c"
+#line 3295 "parse.c"
 break;
 case 56:
-#line 344 "parse.y"
-	{ code1(_CAT) ; }
-#line 2995 "parse.c"
+#line 367 "parse.y"
+	{ code_cat(yystack.l_mark[-1].start, yystack.l_mark[0].start) ; }
+#line 3300 "parse.c"
 break;
 case 57:
-#line 348 "parse.y"
+#line 371 "parse.y"
 	{  yyval.start = code_offset ; code2(_PUSHD, yystack.l_mark[0].ptr) ; }
-#line 3000 "parse.c"
+#line 3305 "parse.c"
 break;
 case 58:
-#line 350 "parse.y"
+#line 373 "parse.y"
 	{ yyval.start = code_offset ; code2(_PUSHS, yystack.l_mark[0].ptr) ; }
-#line 3005 "parse.c"
+#line 3310 "parse.c"
 break;
 case 59:
-#line 352 "parse.y"
+#line 375 "parse.y"
 	{ check_var(yystack.l_mark[0].stp) ;
             yyval.start = code_offset ;
             if ( is_local(yystack.l_mark[0].stp) )
             { code2op(L_PUSHI, yystack.l_mark[0].stp->offset) ; }
             else code2(_PUSHI, yystack.l_mark[0].stp->stval.cp) ;
           }
-#line 3015 "parse.c"
+#line 3320 "parse.c"
 break;
 case 60:
-#line 360 "parse.y"
+#line 383 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
-#line 3020 "parse.c"
+#line 3325 "parse.c"
 break;
 case 61:
-#line 364 "parse.y"
+#line 387 "parse.y"
 	{ yyval.start = code_offset ;
               code2(_MATCH0, yystack.l_mark[0].ptr) ;
               no_leaks_re_ptr(yystack.l_mark[0].ptr);
             }
-#line 3028 "parse.c"
+#line 3333 "parse.c"
 break;
 case 62:
-#line 370 "parse.y"
-	{ code1(_ADD) ; }
-#line 3033 "parse.c"
+#line 393 "parse.y"
+	{ code_binary(_ADD, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3338 "parse.c"
 break;
 case 63:
-#line 371 "parse.y"
-	{ code1(_SUB) ; }
-#line 3038 "parse.c"
+#line 394 "parse.y"
+	{ code_binary(_SUB, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3343 "parse.c"
 break;
 case 64:
-#line 372 "parse.y"
-	{ code1(_MUL) ; }
-#line 3043 "parse.c"
+#line 395 "parse.y"
+	{ code_binary(_MUL, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3348 "parse.c"
 break;
 case 65:
-#line 373 "parse.y"
-	{ code1(_DIV) ; }
-#line 3048 "parse.c"
+#line 396 "parse.y"
+	{ code_binary(_DIV, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3353 "parse.c"
 break;
 case 66:
-#line 374 "parse.y"
-	{ code1(_MOD) ; }
-#line 3053 "parse.c"
+#line 397 "parse.y"
+	{ code_binary(_MOD, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3358 "parse.c"
 break;
 case 67:
-#line 375 "parse.y"
-	{ code1(_POW) ; }
-#line 3058 "parse.c"
+#line 398 "parse.y"
+	{ code_binary(_POW, yystack.l_mark[-2].start, yystack.l_mark[0].start) ; }
+#line 3363 "parse.c"
 break;
 case 68:
-#line 377 "parse.y"
-	{ yyval.start = yystack.l_mark[0].start ; code1(_NOT) ; }
-#line 3063 "parse.c"
+#line 400 "parse.y"
+	{ yyval.start = yystack.l_mark[0].start ; code_unary(_NOT, yystack.l_mark[0].start) ; }
+#line 3368 "parse.c"
 break;
 case 69:
-#line 379 "parse.y"
-	{ yyval.start = yystack.l_mark[0].start ; code1(_UPLUS) ; }
-#line 3068 "parse.c"
+#line 402 "parse.y"
+	{ yyval.start = yystack.l_mark[0].start ; code_unary(_UPLUS, yystack.l_mark[0].start) ; }
+#line 3373 "parse.c"
 break;
 case 70:
-#line 381 "parse.y"
-	{ yyval.start = yystack.l_mark[0].start ; code1(_UMINUS) ; }
-#line 3073 "parse.c"
+#line 404 "parse.y"
+	{ yyval.start = yystack.l_mark[0].start ; code_unary(_UMINUS, yystack.l_mark[0].start) ; }
+#line 3378 "parse.c"
 break;
 case 72:
-#line 386 "parse.y"
+#line 409 "parse.y"
 	{ check_var(yystack.l_mark[-1].stp) ;
              yyval.start = code_offset ;
              code_address(yystack.l_mark[-1].stp) ;
@@ -3081,56 +3386,56 @@ case 72:
              if ( yystack.l_mark[0].ival == '+' )  code1(_POST_INC) ;
              else  code1(_POST_DEC) ;
            }
-#line 3084 "parse.c"
+#line 3389 "parse.c"
 break;
 case 73:
-#line 394 "parse.y"
+#line 417 "parse.y"
 	{ yyval.start = yystack.l_mark[0].start ;
               if ( yystack.l_mark[-1].ival == '+' ) code1(_PRE_INC) ;
               else  code1(_PRE_DEC) ;
             }
-#line 3092 "parse.c"
+#line 3397 "parse.c"
 break;
 case 74:
-#line 401 "parse.y"
+#line 424 "parse.y"
 	{ if (yystack.l_mark[0].ival == '+' ) code1(F_POST_INC ) ;
              else  code1(F_POST_DEC) ;
            }
-#line 3099 "parse.c"
+#line 3404 "parse.c"
 break;
 case 75:
-#line 405 "parse.y"
+#line 428 "parse.y"
 	{ yyval.start = yystack.l_mark[0].start ;
              if ( yystack.l_mark[-1].ival == '+' ) code1(F_PRE_INC) ;
              else  code1( F_PRE_DEC) ;
            }
-#line 3107 "parse.c"
+#line 3412 "parse.c"
 break;
 case 76:
-#line 412 "parse.y"
+#line 435 "parse.y"
 	{ yyval.start = code_offset ;
           check_var(yystack.l_mark[0].stp) ;
           code_address(yystack.l_mark[0].stp) ;
         }
-#line 3115 "parse.c"
+#line 3420 "parse.c"
 break;
 case 77:
-#line 420 "parse.y"
+#line 443 "parse.y"
 	{ yyval.ival = 0 ; }
-#line 3120 "parse.c"
+#line 3425 "parse.c"
 break;
 case 79:
-#line 425 "parse.y"
+#line 448 "parse.y"
 	{ yyval.ival = 1 ; }
-#line 3125 "parse.c"
+#line 3430 "parse.c"
 break;
 case 80:
-#line 427 "parse.y"
+#line 450 "parse.y"
 	{ yyval.ival = yystack.l_mark[-2].ival + 1 ; }
-#line 3130 "parse.c"
+#line 3435 "parse.c"
 break;
 case 81:
-#line 432 "parse.y"
+#line 455 "parse.y"
 	{ const BI_REC *p = yystack.l_mark[-4].bip ;
           yyval.start = yystack.l_mark[-3].start ;
           if ( (int)p->min_args > yystack.l_mark[-1].ival )
@@ -3145,15 +3450,15 @@ case 81:
               { code1(_PUSHINT) ;  code1(yystack.l_mark[-1].ival) ; }
           func2(_BUILTIN , p->fp) ;
         }
-#line 3148 "parse.c"
+#line 3453 "parse.c"
 break;
 case 82:
-#line 450 "parse.y"
+#line 473 "parse.y"
 	{ yyval.start = code_offset ; }
-#line 3153 "parse.c"
+#line 3458 "parse.c"
 break;
 case 83:
-#line 455 "parse.y"
+#line 478 "parse.y"
 	{ func2(_PRINT, yystack.l_mark[-4].fp) ;
               if ( yystack.l_mark[-2].ival > MAX_ARGS )
                   compile_error("too many arguments in call to %s: %d (maximum %d)",
@@ -3164,89 +3469,92 @@ case 83:
               print_flag = 0 ;
               yyval.start = yystack.l_mark[-3].start ;
             }
-#line 3167 "parse.c"
+#line 3472 "parse.c"
 break;
 case 84:
-#line 467 "parse.y"
+#line 490 "parse.y"
 	{ yyval.fp = bi_print ; print_flag = 1 ;}
-#line 3172 "parse.c"
+#line 3477 "parse.c"
 break;
 case 85:
-#line 468 "parse.y"
+#line 491 "parse.y"
 	{ yyval.fp = bi_printf ; print_flag = 1 ; }
-#line 3177 "parse.c"
+#line 3482 "parse.c"
 break;
 case 86:
-#line 471 "parse.y"
+#line 494 "parse.y"
 	{ code2op(_PUSHINT, yystack.l_mark[0].ival) ; }
-#line 3182 "parse.c"
+#line 3487 "parse.c"
 break;
 case 87:
-#line 473 "parse.y"
+#line 496 "parse.y"
 	{ yyval.ival = yystack.l_mark[-1].arg2p->cnt ; zfree(yystack.l_mark[-1].arg2p,sizeof(ARG2_REC)) ;
              code2op(_PUSHINT, yyval.ival) ;
            }
-#line 3189 "parse.c"
+#line 3494 "parse.c"
 break;
 case 88:
-#line 477 "parse.y"
+#line 500 "parse.y"
 	{ yyval.ival=0 ; code2op(_PUSHINT, 0) ; }
-#line 3194 "parse.c"
+#line 3499 "parse.c"
 break;
 case 89:
-#line 481 "parse.y"
+#line 504 "parse.y"
 	{ yyval.arg2p = ZMALLOC(ARG2_REC) ;
              yyval.arg2p->start = yystack.l_mark[-2].start ;
              yyval.arg2p->cnt = 2 ;
            }
-#line 3202 "parse.c"
+#line 3507 "parse.c"
 break;
 case 90:
-#line 486 "parse.y"
+#line 509 "parse.y"
 	{ yyval.arg2p = yystack.l_mark[-2].arg2p ; yyval.arg2p->cnt++ ; }
-#line 3207 "parse.c"
+#line 3512 "parse.c"
 break;
 case 92:
-#line 491 "parse.y"
+#line 514 "parse.y"
 	{ code2op(_PUSHINT, yystack.l_mark[-1].ival) ; }
-#line 3212 "parse.c"
+#line 3517 "parse.c"
 break;
 case 93:
-#line 498 "parse.y"
-	{  yyval.start = yystack.l_mark[-1].start ; eat_nl() ; code_jmp(_JZ, (INST*)0) ; }
-#line 3217 "parse.c"
+#line 521 "parse.y"
+	{  yyval.start = yystack.l_mark[-1].start ; eat_nl() ; code_if_test(yystack.l_mark[-1].start) ; }
+#line 3522 "parse.c"
 break;
 case 94:
-#line 503 "parse.y"
-	{ patch_jmp( code_ptr ) ;  }
-#line 3222 "parse.c"
+#line 526 "parse.y"
+	{ patch_jmp( code_ptr ) ;
+                  drop_if_false(yystack.l_mark[-1].start, code_offset) ;
+                }
+#line 3529 "parse.c"
 break;
 case 95:
-#line 506 "parse.y"
+#line 531 "parse.y"
 	{ eat_nl() ; code_jmp(_JMP, (INST*)0) ; }
-#line 3227 "parse.c"
+#line 3534 "parse.c"
 break;
 case 96:
-#line 511 "parse.y"
+#line 536 "parse.y"
 	{ patch_jmp(code_ptr) ;
                   patch_jmp(CDP(yystack.l_mark[0].start)) ;
+                  drop_if_false(yystack.l_mark[-3].start, yystack.l_mark[0].start) ;
                 }
-#line 3234 "parse.c"
+#line 3542 "parse.c"
 break;
 case 97:
-#line 520 "parse.y"
+#line 546 "parse.y"
 	{ eat_nl() ; BC_new() ; }
-#line 3239 "parse.c"
+#line 3547 "parse.c"
 break;
 case 98:
-#line 525 "parse.y"
+#line 551 "parse.y"
 	{ yyval.start = yystack.l_mark[-5].start ;
           code_jmp(_JNZ, CDP(yystack.l_mark[-5].start)) ;
           BC_clear(code_ptr, CDP(yystack.l_mark[-2].start)) ; }
-#line 3246 "parse.c"
+#line 3554 "parse.c"
 break;
 case 99:
-#line 531 "parse.y"
+#line 557 "parse.y"
 	{ eat_nl() ; BC_new() ;
                   yyval.start = yystack.l_mark[-1].start ;
 
@@ -3263,10 +3571,10 @@ case 99:
                     code2(_JMP, (INST*)0) ; /* code2() not code_jmp() */
                   }
                 }
-#line 3266 "parse.c"
+#line 3574 "parse.c"
 break;
 case 100:
-#line 551 "parse.y"
+#line 577 "parse.y"
 	{
                   INST *p1 = CDP(yystack.l_mark[-1].start) ;
                   INST *p2 = CDP(yystack.l_mark[0].start) ;
@@ -3289,10 +3597,10 @@ case 100:
                     BC_clear(code_ptr, CDP(yystack.l_mark[0].start)) ;
                   }
                 }
-#line 3292 "parse.c"
+#line 3600 "parse.c"
 break;
 case 101:
-#line 578 "parse.y"
+#line 604 "parse.y"
 	{
                   int cont_offset = code_offset ;
                   unsigned len = code_pop(code_ptr) ;
@@ -3314,25 +3622,25 @@ case 101:
                   BC_clear(code_ptr, CDP(cont_offset)) ;
 
                 }
-#line 3317 "parse.c"
+#line 3625 "parse.c"
 break;
 case 102:
-#line 601 "parse.y"
+#line 627 "parse.y"
 	{ yyval.start = code_offset ; }
-#line 3322 "parse.c"
+#line 3630 "parse.c"
 break;
 case 103:
-#line 603 "parse.y"
+#line 629 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; code1(_POP) ; }
-#line 3327 "parse.c"
+#line 3635 "parse.c"
 break;
 case 104:
-#line 606 "parse.y"
+#line 632 "parse.y"
 	{ yyval.start = code_offset ; }
-#line 3332 "parse.c"
+#line 3640 "parse.c"
 break;
 case 105:
-#line 608 "parse.y"
+#line 634 "parse.y"
 	{
              if ( code_ptr - 2 == CDP(yystack.l_mark[-1].start) &&
                   code_ptr[-2].op == _PUSHD &&
@@ -3347,17 +3655,17 @@ case 105:
                code2(_JMP, (INST*)0) ;
              }
            }
-#line 3350 "parse.c"
+#line 3658 "parse.c"
 break;
 case 106:
-#line 625 "parse.y"
+#line 651 "parse.y"
 	{ eat_nl() ; BC_new() ;
              code_push((INST*)0,0, scope, active_funct) ;
            }
-#line 3357 "parse.c"
+#line 3665 "parse.c"
 break;
 case 107:
-#line 629 "parse.y"
+#line 655 "parse.y"
 	{ INST *p1 = CDP(yystack.l_mark[-1].start) ;
 
              eat_nl() ; BC_new() ;
@@ -3365,18 +3673,18 @@ case 107:
              code_push(p1, (unsigned) CodeOffset(p1), scope, active_funct) ;
              code_ptr -= code_ptr - p1 ;
            }
-#line 3368 "parse.c"
+#line 3676 "parse.c"
 break;
 case 108:
-#line 642 "parse.y"
+#line 668 "parse.y"
 	{ check_array(yystack.l_mark[0].stp) ;
              code_array(yystack.l_mark[0].stp) ;
              code1(A_TEST) ;
             }
-#line 3376 "parse.c"
+#line 3684 "parse.c"
 break;
 case 109:
-#line 647 "parse.y"
+#line 673 "parse.y"
 	{ yyval.start = yystack.l_mark[-3].arg2p->start ;
              code2op(A_CAT, yystack.l_mark[-3].arg2p->cnt) ;
              zfree(yystack.l_mark[-3].arg2p, sizeof(ARG2_REC)) ;
@@ -3385,10 +3693,10 @@ case 109:
              code_array(yystack.l_mark[0].stp) ;
              code1(A_TEST) ;
            }
-#line 3388 "parse.c"
+#line 3696 "parse.c"
 break;
 case 110:
-#line 658 "parse.y"
+#line 684 "parse.y"
 	{
              if ( yystack.l_mark[-1].ival > 1 )
              { code2op(A_CAT, yystack.l_mark[-1].ival) ; }
@@ -3399,10 +3707,10 @@ case 110:
              else code2(AE_PUSHA, yystack.l_mark[-4].stp->stval.array) ;
              yyval.start = yystack.l_mark[-3].start ;
            }
-#line 3402 "parse.c"
+#line 3710 "parse.c"
 break;
 case 111:
-#line 671 "parse.y"
+#line 697 "parse.y"
 	{
              if ( yystack.l_mark[-1].ival > 1 )
              { code2op(A_CAT, yystack.l_mark[-1].ival) ; }
@@ -3413,10 +3721,10 @@ case 111:
              else code2(AE_PUSHI, yystack.l_mark[-4].stp->stval.array) ;
              yyval.start = yystack.l_mark[-3].start ;
            }
-#line 3416 "parse.c"
+#line 3724 "parse.c"
 break;
 case 112:
-#line 683 "parse.y"
+#line 709 "parse.y"
 	{
              if ( yystack.l_mark[-2].ival > 1 )
              { code2op(A_CAT,yystack.l_mark[-2].ival) ; }
@@ -3430,10 +3738,10 @@ case 112:
 
              yyval.start = yystack.l_mark[-4].start ;
            }
-#line 3433 "parse.c"
+#line 3741 "parse.c"
 break;
 case 113:
-#line 700 "parse.y"
+#line 726 "parse.y"
 	{
                yyval.start = yystack.l_mark[-4].start ;
                if ( yystack.l_mark[-2].ival > 1 ) { code2op(A_CAT, yystack.l_mark[-2].ival) ; }
@@ -3441,20 +3749,20 @@ case 113:
                code_array(yystack.l_mark[-5].stp) ;
                code1(A_DEL) ;
              }
-#line 3444 "parse.c"
+#line 3752 "parse.c"
 break;
 case 114:
-#line 708 "parse.y"
+#line 734 "parse.y"
 	{
                 yyval.start = code_offset ;
                 check_array(yystack.l_mark[-1].stp) ;
                 code_array(yystack.l_mark[-1].stp) ;
                 code1(DEL_A) ;
              }
-#line 3454 "parse.c"
+#line 3762 "parse.c"
 break;
 case 115:
-#line 719 "parse.y"
+#line 745 "parse.y"
 	{ eat_nl() ; BC_new() ;
                       yyval.start = code_offset ;
 
@@ -3465,10 +3773,10 @@ case 115:
 
                       code2(SET_ALOOP, (INST*)0) ;
                     }
-#line 3468 "parse.c"
+#line 3776 "parse.c"
 break;
 case 116:
-#line 733 "parse.y"
+#line 759 "parse.y"
 	{
                 INST *p2 = CDP(yystack.l_mark[0].start) ;
 
@@ -3477,15 +3785,15 @@ case 116:
                 code_jmp(ALOOP, p2) ;
                 code1(POP_AL) ;
               }
-#line 3480 "parse.c"
+#line 3788 "parse.c"
 break;
 case 117:
-#line 750 "parse.y"
+#line 776 "parse.y"
 	{ yyval.start = code_offset ; code2(F_PUSHA, yystack.l_mark[0].cp) ; }
-#line 3485 "parse.c"
+#line 3793 "parse.c"
 break;
 case 118:
-#line 752 "parse.y"
+#line 778 "parse.y"
 	{ check_var(yystack.l_mark[0].stp) ;
              yyval.start = code_offset ;
              if ( is_local(yystack.l_mark[0].stp) )
@@ -3499,10 +3807,10 @@ case 118:
 
              CODE_FE_PUSHA() ;
            }
-#line 3502 "parse.c"
+#line 3810 "parse.c"
 break;
 case 119:
-#line 766 "parse.y"
+#line 792 "parse.y"
 	{
              if ( yystack.l_mark[-1].ival > 1 )
              { code2op(A_CAT, yystack.l_mark[-1].ival) ; }
@@ -3516,78 +3824,78 @@ case 119:
 
              yyval.start = yystack.l_mark[-3].start ;
            }
-#line 3519 "parse.c"
+#line 3827 "parse.c"
 break;
 case 120:
-#line 780 "parse.y"
+#line 806 "parse.y"
 	{ yyval.start = yystack.l_mark[0].start ;  CODE_FE_PUSHA() ; }
-#line 3524 "parse.c"
+#line 3832 "parse.c"
 break;
 case 121:
-#line 782 "parse.y"
+#line 808 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
-#line 3529 "parse.c"
+#line 3837 "parse.c"
 break;
 case 122:
-#line 786 "parse.y"
+#line 812 "parse.y"
 	{ field_A2I() ; }
-#line 3534 "parse.c"
+#line 3842 "parse.c"
 break;
 case 123:
-#line 789 "parse.y"
+#line 815 "parse.y"
 	{ code1(F_ASSIGN) ; }
-#line 3539 "parse.c"
+#line 3847 "parse.c"
 break;
 case 124:
-#line 790 "parse.y"
+#line 816 "parse.y"
 	{ code1(F_ADD_ASG) ; }
-#line 3544 "parse.c"
+#line 3852 "parse.c"
 break;
 case 125:
-#line 791 "parse.y"
+#line 817 "parse.y"
 	{ code1(F_SUB_ASG) ; }
-#line 3549 "parse.c"
+#line 3857 "parse.c"
 break;
 case 126:
-#line 792 "parse.y"
+#line 818 "parse.y"
 	{ code1(F_MUL_ASG) ; }
-#line 3554 "parse.c"
+#line 3862 "parse.c"
 break;
 case 127:
-#line 793 "parse.y"
+#line 819 "parse.y"
 	{ code1(F_DIV_ASG) ; }
-#line 3559 "parse.c"
+#line 3867 "parse.c"
 break;
 case 128:
-#line 794 "parse.y"
+#line 820 "parse.y"
 	{ code1(F_MOD_ASG) ; }
-#line 3564 "parse.c"
+#line 3872 "parse.c"
 break;
 case 129:
-#line 795 "parse.y"
+#line 821 "parse.y"
 	{ code1(F_POW_ASG) ; }
-#line 3569 "parse.c"
+#line 3877 "parse.c"
 break;
 case 130:
-#line 802 "parse.y"
+#line 828 "parse.y"
 	{ func2(_BUILTIN, bi_split) ; }
-#line 3574 "parse.c"
+#line 3882 "parse.c"
 break;
 case 131:
-#line 806 "parse.y"
+#line 832 "parse.y"
 	{ yyval.start = yystack.l_mark[-2].start ;
               check_array(yystack.l_mark[0].stp) ;
               code_array(yystack.l_mark[0].stp)  ;
             }
-#line 3582 "parse.c"
+#line 3890 "parse.c"
 break;
 case 132:
-#line 813 "parse.y"
+#line 839 "parse.y"
 	{ code2(_PUSHI, &fs_shadow) ; }
-#line 3587 "parse.c"
+#line 3895 "parse.c"
 break;
 case 133:
-#line 815 "parse.y"
+#line 841 "parse.y"
 	{
                   if ( CDP(yystack.l_mark[-1].start) == code_ptr - 2 )
                   {
@@ -3607,25 +3915,72 @@ case 133:
                     }
                   }
                 }
-#line 3610 "parse.c"
+#line 3918 "parse.c"
 break;
 case 134:
-#line 838 "parse.y"
+#line 866 "parse.y"
+	{ check_array(yystack.l_mark[0].stp) ;
+             code_array(yystack.l_mark[0].stp) ;
+           }
+#line 3925 "parse.c"
+break;
+case 135:
+#line 870 "parse.y"
+	{ yyval.start = yystack.l_mark[-4].start ;
+             code1(_PUSHINT) ; code1(yystack.l_mark[0].ival) ;
+             func2(_BUILTIN, yystack.l_mark[-5].fp) ;
+           }
+#line 3933 "parse.c"
+break;
+case 136:
+#line 876 "parse.y"
+	{ yyval.fp = bi_asort ; }
+#line 3938 "parse.c"
+break;
+case 137:
+#line 877 "parse.y"
+	{ yyval.fp = bi_asorti ; }
+#line 3943 "parse.c"
+break;
+case 138:
+#line 881 "parse.y"
+	{ yyval.ival = 1 ; }
+#line 3948 "parse.c"
+break;
+case 139:
+#line 883 "parse.y"
+	{ yyval.ival = 2 ; }
+#line 3953 "parse.c"
+break;
+case 140:
+#line 885 "parse.y"
+	{ yyval.ival = 3 ; }
+#line 3958 "parse.c"
+break;
+case 141:
+#line 889 "parse.y"
+	{ check_array(yystack.l_mark[0].stp) ;
+                code_array(yystack.l_mark[0].stp) ;
+              }
+#line 3965 "parse.c"
+break;
+case 142:
+#line 896 "parse.y"
 	{ yyval.start = code_offset ;
             code2(_PUSHI,field) ;
             func2(_BUILTIN,bi_length) ;
           }
-#line 3618 "parse.c"
+#line 3973 "parse.c"
 break;
-case 135:
-#line 843 "parse.y"
+case 143:
+#line 901 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ;
             func2(_BUILTIN,bi_length) ;
           }
-#line 3625 "parse.c"
+#line 3980 "parse.c"
 break;
-case 136:
-#line 847 "parse.y"
+case 144:
+#line 905 "parse.y"
 	{
               SYMTAB* stp = yystack.l_mark[-1].stp;
               yyval.start = code_offset;
@@ -3672,25 +4027,25 @@ case 136:
                   break;
               }
           }
-#line 3675 "parse.c"
+#line 4030 "parse.c"
 break;
-case 137:
-#line 895 "parse.y"
+case 145:
+#line 953 "parse.y"
 	{ yyval.start = code_offset ;
             code2(_PUSHI,field) ;
             func2(_BUILTIN,bi_length) ;
           }
-#line 3683 "parse.c"
+#line 4038 "parse.c"
 break;
-case 138:
-#line 904 "parse.y"
+case 146:
+#line 962 "parse.y"
 	{ yyval.start = yystack.l_mark[-3].start ;
           func2(_BUILTIN, bi_match) ;
         }
-#line 3690 "parse.c"
+#line 4045 "parse.c"
 break;
-case 139:
-#line 911 "parse.y"
+case 147:
+#line 969 "parse.y"
 	{
                INST *p1 = CDP(yystack.l_mark[0].start) ;
 
@@ -3710,92 +4065,94 @@ case 139:
                  }
                }
              }
-#line 3713 "parse.c"
+#line 4068 "parse.c"
 break;
-case 140:
-#line 935 "parse.y"
+case 148:
+#line 993 "parse.y"
 	{ yyval.start = code_offset ;
-                      code1(_EXIT0) ; }
-#line 3719 "parse.c"
+                      code1(_EXIT0) ;
+                      leave_statement(yyval.start) ; }
+#line 4075 "parse.c"
 break;
-case 141:
-#line 938 "parse.y"
-	{ yyval.start = yystack.l_mark[-1].start ; code1(_EXIT) ; }
-#line 3724 "parse.c"
+case 149:
+#line 997 "parse.y"
+	{ yyval.start = yystack.l_mark[-1].start ; code1(_EXIT) ; leave_statement(yyval.start) ; }
+#line 4080 "parse.c"
 break;
-case 142:
-#line 942 "parse.y"
+case 150:
+#line 1001 "parse.y"
 	{ yyval.start = code_offset ;
-                      code1(_RET0) ; }
-#line 3730 "parse.c"
+                      code1(_RET0) ;
+                      leave_statement(yyval.start) ; }
+#line 4087 "parse.c"
 break;
-case 143:
-#line 945 "parse.y"
-	{ yyval.start = yystack.l_mark[-1].start ; code1(_RET) ; }
-#line 3735 "parse.c"
+case 151:
+#line 1005 "parse.y"
+	{ yyval.start = yystack.l_mark[-1].start ; code1(_RET) ; leave_statement(yyval.start) ; }
+#line 4092 "parse.c"
 break;
-case 144:
-#line 951 "parse.y"
+case 152:
+#line 1011 "parse.y"
 	{ yyval.start = code_offset ;
             code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(0) ;
             func2(_BUILTIN, bi_getline) ;
             getline_flag = 0 ;
           }
-#line 3745 "parse.c"
+#line 4102 "parse.c"
 break;
-case 145:
-#line 958 "parse.y"
+case 153:
+#line 1018 "parse.y"
 	{ yyval.start = yystack.l_mark[0].start ;
             code1(_PUSHINT) ; code1(0) ;
             func2(_BUILTIN, bi_getline) ;
             getline_flag = 0 ;
           }
-#line 3754 "parse.c"
+#line 4111 "parse.c"
 break;
-case 146:
-#line 964 "parse.y"
+case 154:
+#line 1024 "parse.y"
 	{ code1(_PUSHINT) ; code1(F_IN) ;
             func2(_BUILTIN, bi_getline) ;
             /* getline_flag already off in yylex() */
           }
-#line 3762 "parse.c"
+#line 4119 "parse.c"
 break;
-case 147:
-#line 969 "parse.y"
+case 155:
+#line 1029 "parse.y"
 	{ code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             func2(_BUILTIN, bi_getline) ;
           }
-#line 3770 "parse.c"
+#line 4127 "parse.c"
 break;
-case 148:
-#line 974 "parse.y"
+case 156:
+#line 1034 "parse.y"
 	{
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             func2(_BUILTIN, bi_getline) ;
           }
-#line 3778 "parse.c"
+#line 4135 "parse.c"
 break;
-case 149:
-#line 980 "parse.y"
+case 157:
+#line 1040 "parse.y"
 	{ getline_flag = 1 ; }
-#line 3783 "parse.c"
+#line 4140 "parse.c"
 break;
-case 152:
-#line 985 "parse.y"
+case 160:
+#line 1045 "parse.y"
 	{ yyval.start = code_offset ;
                    code2(F_PUSHA, field+0) ;
                  }
-#line 3790 "parse.c"
+#line 4147 "parse.c"
 break;
-case 153:
-#line 989 "parse.y"
+case 161:
+#line 1049 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
-#line 3795 "parse.c"
+#line 4152 "parse.c"
 break;
-case 154:
-#line 997 "parse.y"
+case 162:
+#line 1057 "parse.y"
 	{
              INST *p5 = CDP(yystack.l_mark[-1].start) ;
              INST *p6 = CDP(yystack.l_mark[0].start) ;
@@ -3813,41 +4170,41 @@ case 154:
              func2(_BUILTIN, yystack.l_mark[-5].fp) ;
              yyval.start = yystack.l_mark[-3].start ;
            }
-#line 3816 "parse.c"
+#line 4173 "parse.c"
 break;
-case 155:
-#line 1016 "parse.y"
+case 163:
+#line 1076 "parse.y"
 	{ yyval.fp = bi_sub ; }
-#line 3821 "parse.c"
+#line 4178 "parse.c"
 break;
-case 156:
-#line 1017 "parse.y"
+case 164:
+#line 1077 "parse.y"
 	{ yyval.fp = bi_gsub ; }
-#line 3826 "parse.c"
+#line 4183 "parse.c"
 break;
-case 157:
-#line 1022 "parse.y"
+case 165:
+#line 1082 "parse.y"
 	{ yyval.start = code_offset ;
                   code2(F_PUSHA, &field[0]) ;
                 }
-#line 3833 "parse.c"
+#line 4190 "parse.c"
 break;
-case 158:
-#line 1027 "parse.y"
+case 166:
+#line 1087 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ; }
-#line 3838 "parse.c"
+#line 4195 "parse.c"
 break;
-case 159:
-#line 1035 "parse.y"
+case 167:
+#line 1095 "parse.y"
 	{
                    resize_fblock(yystack.l_mark[-1].fbp) ;
                    restore_ids() ;
                    switch_code_to_main() ;
                  }
-#line 3847 "parse.c"
+#line 4204 "parse.c"
 break;
-case 160:
-#line 1044 "parse.y"
+case 168:
+#line 1104 "parse.y"
 	{ eat_nl() ;
                    scope = SCOPE_FUNCT ;
                    active_funct = yystack.l_mark[-3].fbp ;
@@ -3866,10 +4223,10 @@ case 160:
                    improve_arglist(yystack.l_mark[-3].fbp->name);
                    free_arglist();
                  }
-#line 3869 "parse.c"
+#line 4226 "parse.c"
 break;
-case 161:
-#line 1065 "parse.y"
+case 169:
+#line 1125 "parse.y"
 	{ FBLOCK  *fbp ;
 
                    if ( yystack.l_mark[0].stp == NULL )
@@ -3895,32 +4252,32 @@ case 161:
                    }
                    yyval.fbp = fbp ;
                  }
-#line 3898 "parse.c"
+#line 4255 "parse.c"
 break;
-case 162:
-#line 1092 "parse.y"
+case 170:
+#line 1152 "parse.y"
 	{ yyval.fbp = yystack.l_mark[0].fbp ;
                    if ( yystack.l_mark[0].fbp->code )
                        compile_error("redefinition of %s" , yystack.l_mark[0].fbp->name) ;
                  }
-#line 3906 "parse.c"
+#line 4263 "parse.c"
 break;
-case 163:
-#line 1098 "parse.y"
+case 171:
+#line 1158 "parse.y"
 	{ yyval.ival = init_arglist() ; }
-#line 3911 "parse.c"
+#line 4268 "parse.c"
 break;
-case 165:
-#line 1103 "parse.y"
+case 173:
+#line 1163 "parse.y"
 	{ init_arglist();
                 yystack.l_mark[0].stp = save_arglist(yystack.l_mark[0].stp->name) ;
                 yystack.l_mark[0].stp->offset = 0 ;
                 yyval.ival = 1 ;
               }
-#line 3920 "parse.c"
+#line 4277 "parse.c"
 break;
-case 166:
-#line 1109 "parse.y"
+case 174:
+#line 1169 "parse.y"
 	{ if ( is_local(yystack.l_mark[0].stp) )
                   compile_error("%s is duplicated in argument list",
                     yystack.l_mark[0].stp->name) ;
@@ -3930,10 +4287,10 @@ case 166:
                   yyval.ival = yystack.l_mark[-2].ival + 1 ;
                 }
               }
-#line 3933 "parse.c"
+#line 4290 "parse.c"
 break;
-case 167:
-#line 1121 "parse.y"
+case 175:
+#line 1181 "parse.y"
 	{  /* we may have to recover from a bungled function
                        definition */
                    /* can have local ids, before code scope
@@ -3942,10 +4299,10 @@ case 167:
 
                     switch_code_to_main() ;
                  }
-#line 3945 "parse.c"
+#line 4302 "parse.c"
 break;
-case 168:
-#line 1134 "parse.y"
+case 176:
+#line 1194 "parse.y"
 	{ yyval.start = yystack.l_mark[-1].start ;
              code2(_CALL, yystack.l_mark[-2].fbp) ;
 
@@ -3954,29 +4311,29 @@ case 168:
 
              check_fcall(yystack.l_mark[-2].fbp, scope, code_move_level, active_funct, yystack.l_mark[0].ca_p) ;
            }
-#line 3957 "parse.c"
+#line 4314 "parse.c"
 break;
-case 169:
-#line 1145 "parse.y"
+case 177:
+#line 1205 "parse.y"
 	{ yyval.ca_p = (CA_REC *) 0 ; }
-#line 3962 "parse.c"
+#line 4319 "parse.c"
 break;
-case 170:
-#line 1147 "parse.y"
+case 178:
+#line 1207 "parse.y"
 	{ yyval.ca_p = yystack.l_mark[0].ca_p ;
                  yyval.ca_p->link = yystack.l_mark[-1].ca_p ;
                  yyval.ca_p->arg_num = (NUM_ARGS) (yystack.l_mark[-1].ca_p ? yystack.l_mark[-1].ca_p->arg_num+1 : 0) ;
                  yyval.ca_p->call_lineno = token_lineno;
                }
-#line 3971 "parse.c"
+#line 4328 "parse.c"
 break;
-case 171:
-#line 1163 "parse.y"
+case 179:
+#line 1223 "parse.y"
 	{ yyval.ca_p = (CA_REC *) 0 ; }
-#line 3976 "parse.c"
+#line 4333 "parse.c"
 break;
-case 172:
-#line 1165 "parse.y"
+case 180:
+#line 1225 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->link = yystack.l_mark[-2].ca_p ;
                 yyval.ca_p->type = CA_EXPR  ;
@@ -3984,10 +4341,10 @@ case 172:
                 yyval.ca_p->call_offset = code_offset ;
                 yyval.ca_p->call_lineno = token_lineno;
               }
-#line 3987 "parse.c"
+#line 4344 "parse.c"
 break;
-case 173:
-#line 1173 "parse.y"
+case 181:
+#line 1233 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = ST_NONE ;
                 yyval.ca_p->link = yystack.l_mark[-2].ca_p ;
@@ -3996,25 +4353,25 @@ case 173:
 
                 code_call_id(yyval.ca_p, yystack.l_mark[-1].stp) ;
               }
-#line 3999 "parse.c"
+#line 4356 "parse.c"
 break;
-case 174:
-#line 1184 "parse.y"
+case 182:
+#line 1244 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = CA_EXPR ;
                 yyval.ca_p->call_offset = code_offset ;
               }
-#line 4007 "parse.c"
+#line 4364 "parse.c"
 break;
-case 175:
-#line 1190 "parse.y"
+case 183:
+#line 1250 "parse.y"
 	{ yyval.ca_p = ZMALLOC(CA_REC) ;
                 yyval.ca_p->type = ST_NONE ;
                 code_call_id(yyval.ca_p, yystack.l_mark[-1].stp) ;
               }
-#line 4015 "parse.c"
+#line 4372 "parse.c"
 break;
-#line 4017 "parse.c"
+#line 4374 "parse.c"
     default:
         break;
     }
@@ -62,21 +62,23 @@
 #define MATCH_FUNC 314
 #define SUB 315
 #define GSUB 316
-#define DO 317
-#define WHILE 318
-#define FOR 319
-#define BREAK 320
-#define CONTINUE 321
-#define IF 322
-#define ELSE 323
-#define DELETE 324
-#define BEGIN 325
-#define END 326
-#define EXIT 327
-#define NEXT 328
-#define NEXTFILE 329
-#define RETURN 330
-#define FUNCTION 331
+#define ASORT 317
+#define ASORTI 318
+#define DO 319
+#define WHILE 320
+#define FOR 321
+#define BREAK 322
+#define CONTINUE 323
+#define IF 324
+#define ELSE 325
+#define DELETE 326
+#define BEGIN 327
+#define END 328
+#define EXIT 329
+#define NEXT 330
+#define NEXTFILE 331
+#define RETURN 332
+#define FUNCTION 333
 #ifdef YYSTYPE
 #undef  YYSTYPE_IS_DECLARED
 #define YYSTYPE_IS_DECLARED 1
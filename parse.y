@@ -25,6 +25,7 @@ the GNU General Public License, version 2, 1991.
 #define Visible_DEFER_LEN
 #define Visible_FCALL_REC
 #define Visible_FBLOCK
+#define Visible_STRING
 #define Visible_SYMTAB
 
 #include <mawk.h>
@@ -44,6 +45,8 @@ extern int yylex(void);
 #endif
 
 extern void eat_nl(void);
+extern double double_zero;
+extern double double_one;
 
 static SYMTAB *save_arglist(const char *);
 static int init_arglist(void);
@@ -52,6 +55,13 @@ static void check_array(SYMTAB *);
 static void check_var(SYMTAB *);
 static void code_array(SYMTAB *);
 static void code_call_id(CA_REC *, SYMTAB *);
+static void code_binary(int, int, int);
+static void code_unary(int, int);
+static void code_cat(int, int);
+static void code_if_test(int);
+static void drop_if_false(int, int);
+static void leave_statement(int);
+static void list_statement(int, int);
 static void field_A2I(void);
 static void free_arglist(void);
 static void improve_arglist(const char *);
@@ -63,6 +73,11 @@ static FBLOCK *active_funct;
 static CA_REC *active_arglist;
       /* when scope is SCOPE_FUNCT  */
 
+static int leave_start = -1, leave_end;
+      /* last next, nextfile, exit or return statement */
+static int dead_list = -1, dead_offset;
+      /* statements from dead_offset in this list are never executed */
+
 #define  code_address(x)  if( is_local(x) ) \
                              code2op(L_PUSHA, (x)->offset) ;\
                           else  code2(_PUSHA, (x)->stval.cp)
@@ -127,7 +142,7 @@ static CA_REC *active_arglist;
 %token  <bip> BUILTIN  LENGTH
 %token  <cp>  FIELD
 
-%token  PRINT PRINTF SPLIT MATCH_FUNC SUB GSUB
+%token  PRINT PRINTF SPLIT MATCH_FUNC SUB GSUB ASORT ASORTI
 /* keywords */
 %token  DO WHILE FOR BREAK CONTINUE IF ELSE  IN
 %token  DELETE  BEGIN  END  EXIT NEXT NEXTFILE RETURN  FUNCTION
@@ -145,8 +160,8 @@ static CA_REC *active_arglist;
 %type <start>  array_loop_front
 %type <start>  return_statement
 %type <start>  split_front  re_arg sub_back
-%type <ival>   arglist args
-%type <fp>     print   sub_or_gsub
+%type <ival>   arglist args sort_back
+%type <fp>     print   sub_or_gsub sort_func
 %type <fbp>    funct_start funct_head
 %type <ca_p>   call_args ca_front ca_back
 %type <ival>   f_arglist f_args
@@ -218,7 +233,9 @@ PA_block  :  block
 
 
 block   :  LBRACE   statement_list  RBRACE
-            { $$ = $2 ; }
+            { $$ = $2 ;
+              if ( dead_list == $2 ) dead_list = -1 ;
+            }
         |  LBRACE   error  RBRACE
             { $$ = code_offset ; /* does nothing won't be executed */
               print_flag = getline_flag = paren_cnt = 0 ;
@@ -234,7 +251,9 @@ block_or_separator  :  block
         ;
 
 statement_list :  statement
+             { list_statement($1, $1) ; }
         |  statement_list   statement
+             { list_statement($1, $2) ; }
         ;
 
 
@@ -251,10 +270,12 @@ statement :  block
               }
           |  BREAK  separator
              { $$ = code_offset ; BC_insert('B', code_ptr+1) ;
-               code2(_JMP, 0) /* don't use code_jmp ! */ ; }
+               code2(_JMP, 0) /* don't use code_jmp ! */ ;
+               leave_statement($$) ; }
           |  CONTINUE  separator
              { $$ = code_offset ; BC_insert('C', code_ptr+1) ;
-               code2(_JMP, 0) ; }
+               code2(_JMP, 0) ;
+               leave_statement($$) ; }
           |  return_statement
              { if ( scope != SCOPE_FUNCT )
                      compile_error("return outside function body") ;
@@ -264,12 +285,14 @@ statement :  block
                    compile_error( "improper use of next" ) ;
                 $$ = code_offset ;
                 code1(_NEXT) ;
+                leave_statement($$) ;
               }
           |  NEXTFILE  separator
               { if ( scope != SCOPE_MAIN )
                    compile_error( "improper use of nextfile" ) ;
                 $$ = code_offset ;
                 code1(_NEXTFILE) ;
+                leave_statement($$) ;
               }
           ;
 
@@ -284,12 +307,12 @@ expr  :   cat_expr
       |   lvalue   DIV_ASG  expr { code1(_DIV_ASG) ; }
       |   lvalue   MOD_ASG  expr { code1(_MOD_ASG) ; }
       |   lvalue   POW_ASG  expr { code1(_POW_ASG) ; }
-      |   expr EQ expr  { code1(_EQ) ; }
-      |   expr NEQ expr { code1(_NEQ) ; }
-      |   expr LT expr { code1(_LT) ; }
-      |   expr LTE expr { code1(_LTE) ; }
-      |   expr GT expr { code1(_GT) ; }
-      |   expr GTE expr { code1(_GTE) ; }
+      |   expr EQ expr  { code_binary(_EQ, $1, $3) ; }
+      |   expr NEQ expr { code_binary(_NEQ, $1, $3) ; }
+      |   expr LT expr { code_binary(_LT, $1, $3) ; }
+      |   expr LTE expr { code_binary(_LTE, $1, $3) ; }
+      |   expr GT expr { code_binary(_GT, $1, $3) ; }
+      |   expr GTE expr { code_binary(_GTE, $1, $3) ; }
 
       |   expr MATCH expr
           {
@@ -341,7 +364,7 @@ expr  :   cat_expr
 
 cat_expr :  p_expr             %prec CAT
          |  cat_expr  p_expr   %prec CAT
-            { code1(_CAT) ; }
+            { code_cat($1, $2) ; }
          ;
 
 p_expr  :   DOUBLE
@@ -367,18 +390,18 @@ p_expr  :   RE
             }
         ;
 
-p_expr  :   p_expr  PLUS   p_expr { code1(_ADD) ; }
-      |   p_expr MINUS  p_expr { code1(_SUB) ; }
-      |   p_expr  MUL   p_expr { code1(_MUL) ; }
-      |   p_expr  DIV  p_expr { code1(_DIV) ; }
-      |   p_expr  MOD  p_expr { code1(_MOD) ; }
-      |   p_expr  POW  p_expr { code1(_POW) ; }
+p_expr  :   p_expr  PLUS   p_expr { code_binary(_ADD, $1, $3) ; }
+      |   p_expr MINUS  p_expr { code_binary(_SUB, $1, $3) ; }
+      |   p_expr  MUL   p_expr { code_binary(_MUL, $1, $3) ; }
+      |   p_expr  DIV  p_expr { code_binary(_DIV, $1, $3) ; }
+      |   p_expr  MOD  p_expr { code_binary(_MOD, $1, $3) ; }
+      |   p_expr  POW  p_expr { code_binary(_POW, $1, $3) ; }
       |   NOT  p_expr
-                { $$ = $2 ; code1(_NOT) ; }
+                { $$ = $2 ; code_unary(_NOT, $2) ; }
       |   PLUS p_expr  %prec  UMINUS
-                { $$ = $2 ; code1(_UPLUS) ; }
+                { $$ = $2 ; code_unary(_UPLUS, $2) ; }
       |   MINUS p_expr %prec  UMINUS
-                { $$ = $2 ; code1(_UMINUS) ; }
+                { $$ = $2 ; code_unary(_UMINUS, $2) ; }
       |   builtin
       ;
 
@@ -495,12 +518,14 @@ pr_direction : /* empty */
 /*  IF and IF-ELSE */
 
 if_front :  IF LPAREN expr RPAREN
-            {  $$ = $3 ; eat_nl() ; code_jmp(_JZ, (INST*)0) ; }
+            {  $$ = $3 ; eat_nl() ; code_if_test($3) ; }
          ;
 
 /* if_statement */
 statement : if_front statement
-                { patch_jmp( code_ptr ) ;  }
+                { patch_jmp( code_ptr ) ;
+                  drop_if_false($1, code_offset) ;
+                }
               ;
 
 else_back    :  ELSE { eat_nl() ; code_jmp(_JMP, (INST*)0) ; }
@@ -510,6 +535,7 @@ else_back    :  ELSE { eat_nl() ; code_jmp(_JMP, (INST*)0) ; }
 statement :  if_front statement else_back statement
                 { patch_jmp(code_ptr) ;
                   patch_jmp(CDP($4)) ;
+                  drop_if_false($1, $4) ;
                 }
         ;
 
@@ -833,6 +859,38 @@ split_back  :   RPAREN
                 }
             ;
 
+/* asort(A [,B [,how]]) and asorti(A [,B [,how]]) take arrays, and
+   push the number of arguments like a builtin with variable args */
+
+p_expr  :  sort_func mark LPAREN ID
+           { check_array($4) ;
+             code_array($4) ;
+           }
+           sort_back
+           { $$ = $2 ;
+             code1(_PUSHINT) ; code1($6) ;
+             func2(_BUILTIN, $1) ;
+           }
+        ;
+
+sort_func  :  ASORT   { $$ = bi_asort ; }
+           |  ASORTI  { $$ = bi_asorti ; }
+           ;
+
+sort_back  :  RPAREN
+              { $$ = 1 ; }
+           |  sort_dest RPAREN
+              { $$ = 2 ; }
+           |  sort_dest COMMA expr RPAREN
+              { $$ = 3 ; }
+           ;
+
+sort_dest  :  COMMA ID
+              { check_array($2) ;
+                code_array($2) ;
+              }
+           ;
+
 /* distinguish length vs length(string) vs length(array) */
 p_expr :  LENGTH LPAREN  RPAREN
           { $$ = code_offset ;
@@ -933,16 +991,18 @@ re_arg   :   expr
 /* exit_statement */
 statement      :  EXIT   separator
                     { $$ = code_offset ;
-                      code1(_EXIT0) ; }
+                      code1(_EXIT0) ;
+                      leave_statement($$) ; }
                |  EXIT   expr  separator
-                    { $$ = $2 ; code1(_EXIT) ; }
+                    { $$ = $2 ; code1(_EXIT) ; leave_statement($$) ; }
         ;
 
 return_statement :  RETURN   separator
                     { $$ = code_offset ;
-                      code1(_RET0) ; }
+                      code1(_RET0) ;
+                      leave_statement($$) ; }
                |  RETURN   expr  separator
-                    { $$ = $2 ; code1(_RET) ; }
+                    { $$ = $2 ; code1(_RET) ; leave_statement($$) ; }
         ;
 
 /* getline */
@@ -1306,6 +1366,214 @@ resize_fblock(FBLOCK * fbp)
 	add_to_fdump_list(fbp);
 }
 
+/* Constant folding.  The operands of an operator are the last
+   instructions coded; if they are constants, the operator is applied
+   now instead of each time the code is executed.  Only numbers are
+   folded that the run-time code could not have reported as an error.
+*/
+
+#define is_pushd(p)  ((p)->op == _PUSHD)
+#define pushd_value(p)  (*(double *) (p)[1].ptr)
+#define is_finite(d)  (!isinf(d) && !isnan(d))
+
+static void
+replace_pushd(INST * p, double d)
+{
+    double *dp;
+
+    if (p[1].ptr != (PTR) & double_zero && p[1].ptr != (PTR) & double_one)
+	dp = (double *) p[1].ptr;
+    else
+	dp = ZMALLOC(double);
+    *dp = d;
+    p[1].ptr = (PTR) dp;
+}
+
+static void
+free_pushd(INST * p)
+{
+    if (p[1].ptr != (PTR) & double_zero && p[1].ptr != (PTR) & double_one)
+	ZFREE((double *) p[1].ptr);
+}
+
+static void
+code_binary(int op, int left, int right)
+{
+    INST *p1 = CDP(left);
+    INST *p2 = CDP(right);
+    double x, y, z = 0.0;
+    int fold = 1;
+
+    if (p1 + 2 != p2 || p2 + 2 != code_ptr ||
+	!is_pushd(p1) || !is_pushd(p2)) {
+	code1(op);
+	return;
+    }
+
+    x = pushd_value(p1);
+    y = pushd_value(p2);
+    if (!is_finite(x) || !is_finite(y)) {
+	code1(op);
+	return;
+    }
+
+    switch (op) {
+    case _ADD:
+	z = x + y;
+	break;
+    case _SUB:
+	z = x - y;
+	break;
+    case _MUL:
+	z = x * y;
+	break;
+    case _DIV:
+	if ((fold = (y != 0.0)))
+	    z = x / y;
+	break;
+    case _MOD:
+	if ((fold = (y != 0.0)))
+	    z = fmod(x, y);
+	break;
+    case _POW:
+	z = pow(x, y);
+	break;
+    case _EQ:
+	z = (x == y);
+	break;
+    case _NEQ:
+	z = (x != y);
+	break;
+    case _LT:
+	z = (x < y);
+	break;
+    case _LTE:
+	z = (x <= y);
+	break;
+    case _GT:
+	z = (x > y);
+	break;
+    default:			/* _GTE */
+	z = (x >= y);
+	break;
+    }
+
+    /* leave division by zero, overflow, etc., to the run-time checks */
+    if (!fold || !is_finite(z)) {
+	code1(op);
+	return;
+    }
+
+    replace_pushd(p1, z);
+    free_pushd(p2);
+    code_ptr = p2;
+}
+
+static void
+code_unary(int op, int operand)
+{
+    INST *p = CDP(operand);
+
+    if (p + 2 != code_ptr || !is_pushd(p)) {
+	code1(op);
+    } else if (op == _UMINUS) {
+	replace_pushd(p, -pushd_value(p));
+    } else if (op == _NOT) {
+	replace_pushd(p, pushd_value(p) != 0.0 ? 0.0 : 1.0);
+    }
+    /* unary plus of a number does nothing */
+}
+
+/* "a" "b" is coded as the one string "ab".  Numbers are not folded,
+   since their conversion depends on CONVFMT when the code runs.
+*/
+static void
+code_cat(int left, int right)
+{
+    INST *p1 = CDP(left);
+    INST *p2 = CDP(right);
+
+    if (p1 + 2 == p2 && p2 + 2 == code_ptr &&
+	p1->op == _PUSHS && p2->op == _PUSHS) {
+	STRING *s1 = (STRING *) p1[1].ptr;
+	STRING *s2 = (STRING *) p2[1].ptr;
+	STRING *b = new_STRING0(SizePlus(s1->len, s2->len));
+
+	memcpy(b->str, s1->str, s1->len);
+	memcpy(b->str + s1->len, s2->str, s2->len);
+	free_STRING(s1);
+	free_STRING(s2);
+	p1[1].ptr = (PTR) b;
+	code_ptr = p2;
+    } else {
+	code1(_CAT);
+    }
+}
+
+/* Dead code.  An if statement whose test is a false constant jumps
+   around its body, which drop_if_false() then discards.  The
+   statements following a next, nextfile, exit or return in the same
+   statement list are discarded by list_statement().  Code is only
+   discarded if nothing refers to it, see code_discardable().
+*/
+
+static void
+code_if_test(int test)
+{
+    if (CDP(test) == code_ptr - 2 && is_pushd(code_ptr - 2) &&
+	pushd_value(code_ptr - 2) == 0.0) {
+	free_pushd(code_ptr - 2);
+	code_ptr -= 2;
+	code_jmp(_JMP, (INST *) 0);
+    } else {
+	code_jmp(_JZ, (INST *) 0);
+    }
+}
+
+/* discard the code of an if statement from its start up to the else
+   part (or the end), moving the else part down to start */
+static void
+drop_if_false(int start, int else_part)
+{
+    INST *p = CDP(start);
+
+    /* an expression never starts with _JMP, see code_if_test() */
+    if (p->op == _JMP && code_discardable(p, scope, active_funct)) {
+	INST *q = CDP(else_part);
+	size_t len = (size_t) (code_ptr - q);
+
+	code_discard(p, q);
+	if (len)
+	    memmove(p, q, INST_BYTES(len));
+	code_ptr = p + len;
+	if (dead_offset > start)
+	    dead_list = -1;
+    }
+}
+
+static void
+leave_statement(int start)
+{
+    leave_start = start;
+    leave_end = code_offset;
+}
+
+static void
+list_statement(int list, int stmt)
+{
+    if (list == dead_list && stmt == dead_offset) {
+	if (code_discardable(CDP(stmt), scope, active_funct)) {
+	    code_discard(CDP(stmt), code_ptr);
+	    code_ptr = CDP(stmt);
+	}
+    } else if (dead_list < 0 &&
+	       stmt == leave_start && code_offset == leave_end) {
+	dead_list = list;
+	dead_offset = code_offset;
+    }
+    leave_start = -1;
+}
+
 /* convert FE_PUSHA  to  FE_PUSHI
    or F_PUSH to F_PUSHI
 */
@@ -1509,6 +1777,10 @@ parse(void)
 
     if (compile_error_count != 0)
 	mawk_exit(2);
+    code_inline();
+    code_hoist();
+    code_fuse();
+    code_specialize();
     if (dump_code_flag) {
 	dump_code();
 	mawk_exit(0);
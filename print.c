@@ -123,7 +123,9 @@ print_cell(CELL *p, FILE *fp)
 
 	    /* integers print as "%[l]d" */
 	    if ((double) ival == p->dval && (p->dval != (double) Max_Long)) {
-		fprintf(fp, LONG_FMT, ival);
+		char xbuff[32];
+
+		fwrite(xbuff, (size_t) 1, L_to_str(ival, xbuff), fp);
 	    } else {
 		const char *format = string(OFMT)->str;
 		switch (type_of_OFMT()) {
@@ -65,7 +65,6 @@ re_compile(STRING * sval)
     p->sval = sval;
 
     sval->ref_cnt++;
-    p->re.anchored = (*s == '^');
     p->re.is_empty = (sval->len == 0);
     if (!(p->re.compiled = REcompile(s, sval->len))) {
 	ZFREE(p);
@@ -79,6 +78,7 @@ re_compile(STRING * sval)
 	    return (PTR) 0;
 	}
     }
+    p->re.anchored = REanchored(p->re.compiled);
 
   found:
     /* insert p at the front of the list */
@@ -28,12 +28,14 @@ STATE *REcompile(char *, size_t);
 void REdestroy(STATE *);
 int REtest(char *, size_t, STATE *);
 char *REmatch(char *, size_t, STATE *, size_t *, int);
+int REanchored(STATE *);
 void REmprint(STATE *, FILE *);
 #else
 PTR REcompile(char *, size_t);
 void REdestroy(PTR);
 int REtest(char *, size_t, PTR);
 char *REmatch(char *, size_t, PTR, size_t *, int);
+int REanchored(PTR);
 void REmprint(PTR, FILE *);
 #endif
 
@@ -326,7 +326,8 @@ REcompile(char *regexp, size_t len)
 
 	    memset(re, 0, sizeof(mawk_re_t));
 	    re->regexp = strdup(new_regexp);
-	    err_code = regcomp(&re->re, new_regexp, REG_EXTENDED);
+	    err_code = regcomp(&re->re, new_regexp,
+			       REG_EXTENDED | (casefold_flag ? REG_ICASE : 0));
 
 	    free(new_regexp);
 
@@ -343,6 +344,15 @@ REcompile(char *regexp, size_t len)
     return re;
 }
 
+/*
+ * The compiled expression is opaque, so do not assume it is anchored.
+ */
+int
+REanchored(PTR q GCC_UNUSED)
+{
+    return 0;
+}
+
 #ifdef NO_LEAKS
 void
 REdestroy(PTR ptr)
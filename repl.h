@@ -25,7 +25,7 @@ typedef struct _re_data
 #ifdef Visible_RE_DATA
 {
     PTR compiled;		/* must be first... */
-    int anchored;		/* use to limit recursion in gsub */
+    int anchored;		/* matches only at the beginning */
     int is_empty;		/* check if pattern is empty */
 }
 #endif
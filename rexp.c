@@ -448,6 +448,224 @@ markup_loop_levels(MACHINE * mp)
 #define markup_loop_levels(mp) (mp)->start
 #endif /* ! NO_INTERVAL_EXPR */
 
+/*
+ * Return the offset to the target of a jump, or zero if the state does not
+ * jump.
+ */
+static int
+RE_jump_of(STATE * p)
+{
+    switch (p->s_type) {
+    case M_1J:
+    case M_2JA:
+    case M_2JB:
+    case M_2JC:
+#ifndef NO_INTERVAL_EXPR
+    case M_ENTER:
+    case M_LOOP:
+#endif
+	return p->s_data.jump;
+    }
+    return 0;
+}
+
+/*
+ * A loop over a character class can be replaced by M_SPAN, which takes the
+ * longest run, if no shorter run could let the rest of the pattern match.
+ * That holds if the loop is followed by the end of the pattern or string,
+ * or by something which cannot begin with a member of the class.
+ */
+static int
+RE_span_ok(STATE * next, BV * bvp)
+{
+    int result = 0;
+
+    switch (next->s_type) {
+    case M_ACCEPT:
+    case M_END:
+	result = 1;
+	break;
+    case M_STR:
+    case M_STR + END_ON:
+	result = (next->s_len != 0 && !ison(*bvp, next->s_data.str[0]));
+	break;
+    case M_CLASS:
+    case M_CLASS + END_ON:
+	{
+	    size_t n;
+
+	    result = 1;
+	    for (n = 0; n < sizeof(BV); ++n) {
+		if ((*bvp)[n] & (*next->s_data.bvp)[n]) {
+		    result = 0;
+		    break;
+		}
+	    }
+	}
+	break;
+    }
+    return result;
+}
+
+/*
+ * Mark the states which can be reached while still searching for the start
+ * of a match (U_ON), i.e., from the start of the machine or from M_U without
+ * consuming any characters.
+ */
+static void
+RE_mark_search(STATE * p, int len, char *u_on)
+{
+    int changed = 1;
+    int n;
+
+    memset(u_on, 0, (size_t) len);
+    u_on[0] = 1;
+    for (n = 0; n + 1 < len; ++n) {
+	if (p[n].s_type == M_U)
+	    u_on[n + 1] = 1;
+    }
+    while (changed) {
+	changed = 0;
+	for (n = 0; n < len; ++n) {
+	    int next = n + 1;
+	    int target = n;
+
+	    if (!u_on[n])
+		continue;
+	    switch (p[n].s_type) {
+	    case M_1J:
+		next = n;
+		target = n + p[n].s_data.jump;
+		break;
+	    case M_2JA:
+	    case M_2JB:
+	    case M_2JC:
+#ifndef NO_INTERVAL_EXPR
+	    case M_LOOP:
+#endif
+		target = n + p[n].s_data.jump;
+		break;
+	    case M_SAVE_POS:
+#ifndef NO_INTERVAL_EXPR
+	    case M_ENTER:
+#endif
+		break;
+	    default:
+		continue;
+	    }
+	    if (next < len && !u_on[next]) {
+		u_on[next] = 1;
+		changed = 1;
+	    }
+	    if (target >= 0 && target < len && !u_on[target]) {
+		u_on[target] = 1;
+		changed = 1;
+	    }
+	}
+    }
+}
+
+/*
+ * Replace class loops, i.e.,
+ *	[...]+	SAVE_POS, CLASS, 2JC
+ *	[...]*	2JA, SAVE_POS, CLASS, 2JC
+ * by a single M_SPAN state, which is matched without using the run-time
+ * stacks.  Jumps across the replaced states are adjusted.
+ *
+ * While searching for the start of a match, [...]* keeps its 2JA in front of
+ * a span of at least one character, so that the empty alternative is stacked
+ * once rather than each time the span moves on to a later run.
+ */
+static void
+RE_class_spans(MACHINE * mp)
+{
+    STATE *p = mp->start;
+    int len = (int) (mp->stop - mp->start) + 1;
+    int n;
+    char *u_on = (char *) RE_malloc((size_t) len);
+
+    RE_mark_search(p, len, u_on);
+
+    for (n = 0; n < len; ++n) {
+	int size;
+	int least;
+	int keep;
+	int k;
+	STATE *cls;
+
+	if (p[n].s_type == M_2JA
+	    && p[n].s_data.jump == 4
+	    && p[n + 1].s_type == M_SAVE_POS) {
+	    size = 4;
+	    least = 0;
+	} else if (p[n].s_type == M_SAVE_POS) {
+	    size = 3;
+	    least = 1;
+	} else {
+	    continue;
+	}
+	if (n + size >= len)
+	    continue;
+	cls = p + n + size - 2;
+	if (cls->s_type != M_CLASS
+	    || cls[1].s_type != M_2JC
+	    || cls[1].s_data.jump != -2
+	    || !RE_span_ok(p + n + size, cls->s_data.bvp)) {
+	    continue;
+	}
+
+	/* give up if something else jumps into the loop */
+	for (k = 0; k < len; ++k) {
+	    int target = k + RE_jump_of(p + k);
+	    if ((k < n || k >= n + size)
+		&& (target > n && target < n + size)) {
+		break;
+	    }
+	}
+	if (k < len)
+	    continue;
+
+	keep = (least == 0 && u_on[n]) ? 2 : 1;
+
+	TRACE(("RE_class_spans: replace %d states at %d\n", size, n));
+
+	/* adjust jumps which cross the loop */
+	for (k = 0; k < len; ++k) {
+	    int jump = RE_jump_of(p + k);
+	    int target = k + jump;
+
+	    if (jump == 0 || (k >= n && k < n + size))
+		continue;
+	    if (k < n && target >= n + size) {
+		p[k].s_data.jump -= (size - keep);
+	    } else if (k >= n + size && target <= n) {
+		p[k].s_data.jump += (size - keep);
+	    }
+#ifndef NO_INTERVAL_EXPR
+	    if (p[k].s_type == M_LOOP && k >= n + size && k + p[k].s_enter <= n)
+		p[k].s_enter += (size - keep);
+#endif
+	}
+
+	cls->s_type = M_SPAN;
+	if (keep == 2) {
+	    cls->s_len = 1;
+	    p[n].s_data.jump = 2;
+	    p[n + 1] = *cls;
+	} else {
+	    cls->s_len = (size_t) least;
+	    p[n] = *cls;
+	}
+	for (k = n + size; k < len; ++k) {
+	    p[k - size + keep] = p[k];
+	    u_on[k - size + keep] = u_on[k];
+	}
+	len -= (size - keep);
+	mp->stop = mp->start + len - 1;
+    }
+    RE_free(u_on);
+}
+
 /* duplicate_m() relies upon copying machines whose size is 1, i.e., atoms */
 #define BigMachine(mp) (((mp)->stop - (mp)->start) > 1)
 
@@ -635,6 +853,10 @@ REcompile(char *re, size_t len)
 	    if (op_ptr->token == 0) {
 		/*  done   */
 		if (m_ptr == m_stack(0)) {
+		    RE_class_spans(m_ptr);
+		    /* allow each state to be stacked twice before growing */
+		    RE_reserve_stacks((size_t) (2 * (m_ptr->stop
+						     - m_ptr->start + 1)));
 		    return markup_loop_levels(m_ptr);
 		} else {
 		    /* machines still on the stack  */
@@ -38,6 +38,7 @@ extern void RE_free(void *);
 typedef enum {
     M_STR			/* matching a literal string */
     ,M_CLASS			/* character class */
+    ,M_SPAN			/* longest run of a character class */
     ,M_ANY			/* arbitrary character (.) */
     ,M_START			/* start of string (^) */
     ,M_END			/* end of string ($) */
@@ -64,6 +65,10 @@ typedef enum {
 
 typedef UChar BV[32];		/* bit vector */
 
+/*
+ * The per-type data is overlaid, since no state uses both the string length
+ * and the loop-counters.  That keeps the states compact.
+ */
 typedef struct _state
 #ifdef Visible_STATE
 {
@@ -71,21 +76,32 @@ typedef struct _state
 #ifndef NO_INTERVAL_EXPR
     int s_enter;		/* M_LOOP offset to M_ENTER, runtime check */
 #endif
-    size_t s_len;		/* used for M_STR  */
+    union {
+	size_t u_len;		/* used for M_STR, minimum for M_SPAN */
+#ifndef NO_INTERVAL_EXPR
+	struct {
+	    Int i_min;		/* used for s_type == M_LOOP */
+	    Int i_max;		/* used for s_type == M_LOOP */
+	    Int i_cnt;		/* M_ENTER level, M_LOOP working counter */
+	} u_it;
+#endif
+    } s_u;
     union {
 	char *str;		/* string */
-	BV *bvp;		/*  class  */
+	BV *bvp;		/*  class, span  */
 	int jump;
     } s_data;
-#ifndef NO_INTERVAL_EXPR
-    Int it_min;			/* used for s_type == M_LOOP */
-    Int it_max;			/* used for s_type == M_LOOP */
-    Int it_cnt;			/* M_ENTER level, M_LOOP working counter */
-#endif
 }
 #endif
 STATE;
 
+#define s_len	s_u.u_len
+#ifndef NO_INTERVAL_EXPR
+#define it_min	s_u.u_it.i_min
+#define it_max	s_u.u_it.i_max
+#define it_cnt	s_u.u_it.i_cnt
+#endif
+
 #define  STATESZ  (sizeof(STATE))
 
 typedef struct _machine
@@ -201,6 +217,7 @@ extern void RE_run_stack_init(void);
 extern void RE_pos_stack_init(void);
 extern RT_STATE *RE_new_run_stack(void);
 extern RT_POS_ENTRY *RE_new_pos_stack(void);
+extern void RE_reserve_stacks(size_t);
 
 extern RT_STATE *RE_run_stack_base;
 extern RT_STATE *RE_run_stack_limit;
@@ -32,6 +32,8 @@ static int do_str(int, char **, MACHINE *);
 static int do_class(char **, MACHINE *);
 static int escape(char **);
 static BV *store_bvp(BV *);
+static void fold_bvp(BV *);
+static MACHINE fold_str(char *, size_t);
 
 /* make next array visible */
 /* *INDENT-OFF* */
@@ -386,7 +388,13 @@ RE_lex(MACHINE * mp)
 
     /* check for end character */
     if (*re_exp == '$') {
-	mp->start->s_type = (SType) (mp->start->s_type + END_ON);
+	if (mp->stop - mp->start > 1) {
+	    /* a case-folded string is more than one atom */
+	    MACHINE end = RE_end();
+	    RE_cat(mp, &end);
+	} else {
+	    mp->start->s_type = (SType) (mp->start->s_type + END_ON);
+	}
 	re_exp++;
     }
 
@@ -459,6 +467,17 @@ do_str(
 
     *s = 0;
     *pp = p;
+    if (casefold_flag) {
+	for (s = str; s < str + len; ++s) {
+	    if (isalpha((UChar) *s))
+		break;
+	}
+	if (s < str + len) {
+	    *mp = fold_str(str, len);
+	    RE_free(str);
+	    return T_STR;
+	}
+    }
     *mp = RE_str((char *) RE_realloc(str, len + 1), len);
     return T_STR;
 }
@@ -854,6 +873,9 @@ do_class(char **start, MACHINE * mp)
 	}
     }
 
+    if (casefold_flag)
+	fold_bvp(bvp);
+
     if (comp_flag) {
 	for (p = (char *) bvp; p < (char *) bvp + sizeof(BV); p++) {
 	    *p = (char) (~*p);
@@ -864,6 +886,72 @@ do_class(char **start, MACHINE * mp)
     return T_CLASS;
 }
 
+/*
+ * For -W casefold, add the other case of each letter in a bit vector.
+ */
+static void
+fold_bvp(BV * bvp)
+{
+    int c;
+
+    for (c = 0; c < 256; ++c) {
+	if (ison(*bvp, c) && isalpha(c)) {
+	    char_on(*bvp, toupper(c));
+	    char_on(*bvp, tolower(c));
+	}
+    }
+}
+
+/*
+ * Return a machine for the next piece of a case-folded string:
+ * a letter becomes a class matching either case, and a run of
+ * non-letters stays a string.
+ */
+static MACHINE
+fold_atom(char *str, size_t len, size_t *np)
+{
+    size_t n = *np;
+    size_t k = n;
+
+    if (isalpha((UChar) str[n])) {
+	BV *bvp = (BV *) RE_malloc(sizeof(BV));
+
+	memset(bvp, 0, sizeof(BV));
+	char_on(*bvp, (UChar) str[n]);
+	fold_bvp(bvp);
+	*np = n + 1;
+	return RE_class(store_bvp(bvp));
+    } else {
+	char *run;
+
+	while (k < len && !isalpha((UChar) str[k]))
+	    ++k;
+	run = (char *) RE_malloc(k - n + 1);
+	memcpy(run, str + n, k - n);
+	run[k - n] = '\0';
+	*np = k;
+	return RE_str(run, k - n);
+    }
+}
+
+/*
+ * Build the machine for a string containing letters, with -W casefold.
+ * The folding is done once here, so matching costs no more than for
+ * a case-sensitive pattern.
+ */
+static MACHINE
+fold_str(char *str, size_t len)
+{
+    size_t n = 0;
+    MACHINE result = fold_atom(str, len, &n);
+
+    while (n < len) {
+	MACHINE next = fold_atom(str, len, &n);
+	RE_cat(&result, &next);
+    }
+    return result;
+}
+
 /* storage for bit vectors so they can be reused ,
    stored in an unsorted linear array
    the array grows as needed
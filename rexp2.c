@@ -62,14 +62,14 @@ RE_pos_stack_init(void)
    In real life cases, the back tracking usually fails. Some
    work is needed here to improve the algorithm.
    I.e., figure out how not to stack useless paths.
+
+   The stacks are kept between matches, and grow geometrically so that
+   reallocation during a match is rare.
 */
 
-RT_STATE *
-RE_new_run_stack(void)
+static void
+RE_grow_run_stack(size_t newsize)
 {
-    size_t oldsize = (size_t) (RE_run_stack_limit - RE_run_stack_base);
-    size_t newsize = oldsize + STACKGROWTH;
-
 #ifdef	LMDOS			/* large model DOS */
     /* have to worry about overflow on multiplication (ugh) */
     if (newsize >= 4096)
@@ -78,7 +78,8 @@ RE_new_run_stack(void)
 #endif
 
 	RE_run_stack_base = (RT_STATE *) realloc(RE_run_stack_base,
-						 newsize * sizeof(RT_STATE));
+						 SizeTimes(newsize,
+							   sizeof(RT_STATE)));
 
     if (!RE_run_stack_base) {
 	fprintf(stderr, "out of memory for RE run time stack\n");
@@ -90,21 +91,16 @@ RE_new_run_stack(void)
 
     RE_run_stack_limit = RE_run_stack_base + newsize;
     RE_run_stack_empty = RE_run_stack_base - 1;
-
-    return RE_run_stack_base + oldsize;
 }
 
-RT_POS_ENTRY *
-RE_new_pos_stack(void)
+static void
+RE_grow_pos_stack(size_t oldsize, size_t newsize)
 {
-    size_t oldsize = (size_t) (RE_pos_stack_limit - RE_pos_stack_base);
-    size_t newsize = oldsize + STACKGROWTH;
-
     /* FIXME: handle overflow on multiplication for large model DOS
-     * (see RE_new_run_stack()).
+     * (see RE_grow_run_stack()).
      */
     RE_pos_stack_base = (RT_POS_ENTRY *)
-	realloc(RE_pos_stack_base, newsize * sizeof(RT_POS_ENTRY));
+	realloc(RE_pos_stack_base, SizeTimes(newsize, sizeof(RT_POS_ENTRY)));
 
     if (!RE_pos_stack_base) {
 	fprintf(stderr, "out of memory for RE string position stack\n");
@@ -113,14 +109,50 @@ RE_new_pos_stack(void)
 #if OPT_TRACE
     memset(RE_pos_stack_base + oldsize, 0,
 	   (newsize - oldsize) * sizeof(RT_POS_ENTRY));
+#else
+    (void) oldsize;
 #endif
 
     RE_pos_stack_limit = RE_pos_stack_base + newsize;
     RE_pos_stack_empty = RE_pos_stack_base;
+}
+
+RT_STATE *
+RE_new_run_stack(void)
+{
+    size_t oldsize = (size_t) (RE_run_stack_limit - RE_run_stack_base);
+
+    RE_grow_run_stack(SizeTimes(oldsize, 2));
+    return RE_run_stack_base + oldsize;
+}
 
+RT_POS_ENTRY *
+RE_new_pos_stack(void)
+{
+    size_t oldsize = (size_t) (RE_pos_stack_limit - RE_pos_stack_base);
+
+    RE_grow_pos_stack(oldsize, SizeTimes(oldsize, 2));
     return RE_pos_stack_base + oldsize;
 }
 
+/*
+ * Called after compiling a machine, with an estimate of the stack entries
+ * needed for matching it, so the stacks are sized before the first match.
+ */
+void
+RE_reserve_stacks(size_t need)
+{
+    size_t have;
+
+    have = (size_t) (RE_run_stack_limit - RE_run_stack_base);
+    if (need > have)
+	RE_grow_run_stack(need);
+
+    have = (size_t) (RE_pos_stack_limit - RE_pos_stack_base);
+    if (need > have)
+	RE_grow_pos_stack(have, need);
+}
+
 #define rt_push(mx,sx,px,ux) do { \
 	if (++run_entry == RE_run_stack_limit) \
 		run_entry = RE_new_run_stack(); \
@@ -165,6 +197,45 @@ RE_bad_state(const char *where, STATE * m, int u_flag)
 	     where);
 }
 
+/*
+ * Recognize the literal patterns which need no run-time stacks:
+ * "lit", "^lit", "lit$" and "^lit$".  Return the M_STR state, setting
+ * *anchors to the LIT_BOL/LIT_EOL flags, or NULL for other machines.
+ */
+#define LIT_BOL 1
+#define LIT_EOL 2
+
+static STATE *
+RE_literal(STATE * m, int *anchors)
+{
+    int flags = 0;
+
+    if (m->s_type == M_START) {
+	flags = LIT_BOL;
+	m++;
+    }
+    if (m->s_type == M_STR + END_ON) {
+	flags |= LIT_EOL;
+    } else if (m->s_type != M_STR) {
+	return NULL;
+    }
+    if ((m + 1)->s_type != M_ACCEPT)
+	return NULL;
+    *anchors = flags;
+    return m;
+}
+
+/*
+ * A machine which begins with M_START can only match at the beginning of
+ * the string, since every path through the machine passes that state.
+ * Note that ^a|b and ^?a do not begin with M_START.
+ */
+int
+REanchored(STATE * m)
+{
+    return (m->s_type == M_START || m->s_type == M_START + END_ON);
+}
+
 /*
  * test if str ~ /machine/
  */
@@ -189,10 +260,22 @@ REtest(char *str,		/* string to test */
 
     TRACE(("REtest: \"%s\" ~ /pattern/\n", str));
 
-    /* handle the easy case quickly */
-    if (m->s_type == M_STR && (m + 1)->s_type == M_ACCEPT) {
-	TRACE(("returning str_str\n"));
-	return str_str(s, len, m->s_data.str, m->s_len) != (char *) 0;
+    /* handle the easy cases quickly */
+    if ((tm = RE_literal(m, &ti)) != NULL) {
+	TRACE(("returning literal match\n"));
+	switch (ti) {
+	case 0:
+	    return str_str(s, len, tm->s_data.str, tm->s_len) != (char *) 0;
+	case LIT_BOL:
+	    return (len >= tm->s_len
+		    && !memcmp(s, tm->s_data.str, tm->s_len));
+	case LIT_EOL:
+	    return (len >= tm->s_len
+		    && !memcmp(str_end - tm->s_len, tm->s_data.str, tm->s_len));
+	default:
+	    return (len == tm->s_len
+		    && !memcmp(s, tm->s_data.str, tm->s_len));
+	}
     } else {
 	u_flag = U_ON;
 	run_entry = RE_run_stack_empty;
@@ -359,6 +442,38 @@ REtest(char *str,		/* string to test */
 	RE_CASE();
 #endif
 
+    case M_SPAN + U_OFF + END_OFF:
+	if (s < str_end && ison(*m->s_data.bvp, s[0])) {
+	    while (++s < str_end && ison(*m->s_data.bvp, s[0])) {
+		;
+	    }
+	} else if (m->s_len != 0) {
+	    RE_FILL();
+	}
+	m++;
+	RE_CASE();
+
+    case M_SPAN + U_ON + END_OFF:
+	/* RE_class_spans() keeps a 2JA for the empty alternative here */
+	for (;;) {
+	    if (s >= str_end) {
+		RE_FILL();
+	    } else if (ison(*m->s_data.bvp, s[0])) {
+		break;
+	    }
+	    s++;
+	}
+	while (++s < str_end && ison(*m->s_data.bvp, s[0])) {
+	    ;
+	}
+	/* a later run may be needed if the rest of the pattern fails */
+	if (s < str_end) {
+	    rt_push(m, s, pos_entry, U_ON);
+	}
+	m++;
+	u_flag = U_OFF;
+	RE_CASE();
+
     case M_ANY + U_OFF + END_OFF:
 	if (s >= str_end) {
 	    RE_FILL();
@@ -536,3 +651,13 @@ is_string_split(PTR q, size_t *lenp)
     } else
 	return (char *) 0;
 }
+
+/*
+ * Like is_string_split(), but for callers which match rather than split,
+ * e.g., gsub().  The compiled machine is exactly a nonempty literal string.
+ */
+char *
+is_string_match(PTR q, size_t *lenp)
+{
+    return is_string_split(q, lenp);
+}
@@ -70,6 +70,7 @@ REmatch(char *str,		/* string to test */
     const char *old_s;
     RT_STATE *run_entry = NULL;
     int u_flag;
+    int anchors;
     char *str_end;
     RT_POS_ENTRY *pos_entry;
     char *ts;
@@ -83,14 +84,35 @@ REmatch(char *str,		/* string to test */
 
     TRACE(("REmatch: %s \"%s\" ~ /pattern/\n", no_bol ? "any" : "1st", str));
 
-    /* check for the easy case */
-    if (m->s_type == M_STR && (m + 1)->s_type == M_ACCEPT) {
-	if ((ts = str_str(str, str_len, m->s_data.str, m->s_len))) {
+    /* check for the easy cases */
+    if ((m = RE_literal(machine, &anchors)) != NULL) {
+	ts = NULL;
+	switch (anchors) {
+	case 0:
+	    ts = str_str(str, str_len, m->s_data.str, m->s_len);
+	    break;
+	case LIT_BOL:
+	    if (!no_bol && str_len >= m->s_len
+		&& !memcmp(str, m->s_data.str, m->s_len))
+		ts = str;
+	    break;
+	case LIT_EOL:
+	    if (str_len >= m->s_len
+		&& !memcmp(str + str_len - m->s_len, m->s_data.str, m->s_len))
+		ts = str + str_len - m->s_len;
+	    break;
+	default:
+	    if (!no_bol && str_len == m->s_len
+		&& !memcmp(str, m->s_data.str, m->s_len))
+		ts = str;
+	    break;
+	}
+	if (ts)
 	    *lenp = m->s_len;
-	}
 	TR_STR(ts);
 	return ts;
     }
+    m = machine;
 
     str_end = str + str_len;
     s = str;
@@ -335,6 +357,57 @@ REmatch(char *str,		/* string to test */
 	RE_CASE();
 #endif
 
+    case M_SPAN + U_OFF + END_OFF:
+	if (s < str_end && ison(*m->s_data.bvp, s[0])) {
+	    if (!ss) {
+		if (cb_ss && current_best(s)) {
+		    TR_AT("new match is not better");
+		    RE_FILL();
+		} else {
+		    ss = s;
+		}
+	    }
+	    while (++s < str_end && ison(*m->s_data.bvp, s[0])) {
+		;
+	    }
+	} else if (m->s_len != 0) {
+	    RE_FILL();
+	}
+	m++;
+	RE_CASE();
+
+    case M_SPAN + U_ON + END_OFF:
+	/* RE_class_spans() keeps a 2JA for the empty alternative here */
+	if (s < str)
+	    s = str;
+	while (1) {
+	    if (s >= str_end) {
+		RE_FILL();
+	    }
+	    if (ison(*m->s_data.bvp, s[0]))
+		break;
+	    s++;
+	}
+	ts = s;
+	while (++s < str_end && ison(*m->s_data.bvp, s[0])) {
+	    ;
+	}
+	/* a later run may be needed if the rest of the pattern fails */
+	if (s < str_end) {
+	    rt_push(m, s, pos_entry, ss, U_ON);
+	}
+	if (!ss) {
+	    if (cb_ss && current_best(ts)) {
+		TR_AT("new match is not better");
+		RE_FILL();
+	    } else {
+		ss = ts;
+	    }
+	}
+	m++;
+	u_flag = U_OFF;
+	RE_CASE();
+
     case M_ANY + U_OFF + END_OFF:
 	if (s >= str_end) {
 	    RE_FILL();
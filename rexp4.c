@@ -14,6 +14,53 @@ the GNU General Public License, version 2, 1991.
  */
 #include <field.h>
 
+#include <ctype.h>
+
+/* if we have a meta character, it probably is a regex */
+static int
+has_meta_chars(const char *value, size_t len)
+{
+    size_t n;
+
+    for (n = 0; n < len; ++n) {
+	switch (value[n]) {
+	case '\\':
+	case '$':
+	case '(':
+	case ')':
+	case '*':
+	case '+':
+	case '.':
+	case '?':
+	case '[':
+	case ']':
+	case '^':
+	case '|':
+#ifndef NO_INTERVAL_EXPR
+	case L_CURL:
+	case R_CURL:
+#endif
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+/* with -W casefold, a letter must be left to the regex to match */
+static int
+has_folded_chars(const char *value, size_t len)
+{
+    size_t n;
+
+    if (casefold_flag) {
+	for (n = 0; n < len; ++n) {
+	    if (isalpha((UChar) value[n]))
+		return 1;
+	}
+    }
+    return 0;
+}
+
 char *
 is_string_split(PTR q, size_t *lenp)
 {
@@ -22,35 +69,30 @@ is_string_split(PTR q, size_t *lenp)
 	char *result = s->str;
 
 	/* if we have only one character, it cannot be a regex */
-	if (s->len == 1) {
+	if (!has_folded_chars(result, s->len)
+	    && (s->len == 1 || !has_meta_chars(result, s->len))) {
 	    *lenp = s->len;
 	    return result;
-	} else {
-	    size_t n;
-	    for (n = 0; n < s->len; ++n) {
-		/* if we have a meta character, it probably is a regex */
-		switch (result[n]) {
-		case '\\':
-		case '$':
-		case '(':
-		case ')':
-		case '*':
-		case '+':
-		case '.':
-		case '?':
-		case '[':
-		case ']':
-		case '^':
-		case '|':
-#ifndef NO_INTERVAL_EXPR
-		case L_CURL:
-		case R_CURL:
-#endif
-		    return NULL;
-		}
-	    }
+	}
+    }
+    return NULL;
+}
+
+/*
+ * Unlike splitting, a single character such as "." is still a regex when
+ * matching, e.g., for gsub().
+ */
+char *
+is_string_match(PTR q, size_t *lenp)
+{
+    if (q != NULL) {
+	STRING *s = ((RE_NODE *) q)->sval;
+
+	if (s->len != 0
+	    && !has_meta_chars(s->str, s->len)
+	    && !has_folded_chars(s->str, s->len)) {
 	    *lenp = s->len;
-	    return result;
+	    return s->str;
 	}
     }
     return NULL;
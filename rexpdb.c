@@ -24,6 +24,7 @@ static const char xlat[][12] =
 {
     "M_STR",
     "M_CLASS",
+    "M_SPAN",
     "M_ANY",
     "M_START",
     "M_END",
@@ -102,6 +103,7 @@ REmprint(STATE * m, FILE *f)
 	    break;
 #endif
 	case M_CLASS:
+	case M_SPAN:
 	    {
 		UChar *q = (UChar *) p->s_data.bvp;
 		UChar *r = q + sizeof(BV);
@@ -127,6 +129,8 @@ REmprint(STATE * m, FILE *f)
 		    bitnum += 8;
 		}
 		fprintf(f, "]");
+		if (p->s_type == M_SPAN)
+		    fprintf(f, "%c", p->s_len ? '+' : '*');
 	    }
 	    break;
 	}
@@ -0,0 +1,798 @@
+/********************************************
+spill.c
+copyright 2026 Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: spill.c,v 1.1 2026/10/19 00:00:00 tom Exp $
+ */
+
+#define Visible_CELL
+#define Visible_STRING
+
+#include <mawk.h>
+#include <memory.h>
+#include <spill.h>
+
+/* The elements which an array named by -W spill writes out of its table
+   go into runs, each a temporary file of records sorted by spill_compare(),
+   that is, by hash value and then by key.  A record is
+
+	hash value	4 bytes
+	tag		1 byte, the kind of key and what the value holds
+	lengths		varints, of a string key and of a string value
+	key		an Int, or the string
+	number		a double, if the value has one
+	string		of the value, if it has one
+
+   and one without a value stands for a key deleted since an older run was
+   written.  Each run keeps in memory the hash value and offset of every
+   INDEX_STEP'th record, and a Bloom filter of the hash values, so that a
+   lookup of a key which the run lacks seldom reads the file, and one which
+   it has reads only the records between two index entries.  A newer run
+   has the newer copy of a key, so lookups search the newest run first, and
+   the newest runs are merged while they are as large as the one before,
+   dropping the older copies, so that there are few runs.
+
+   Offsets in a run are off_t where there is fseeko(), since a long may
+   have only 32 bits.  A run stops short of the largest offset: the
+   records past it go in another run, which holds no key of the first,
+   and runs are not merged if the result would pass it. */
+
+#define INDEX_STEP      32	/* records per index entry */
+#define BLOOM_BITS      10	/* per record */
+#define BLOOM_PROBES    4
+#define READ_BLOCK      4096
+#define HVAL_SIZE       4
+#define MAX_VARINT      10	/* bytes of a 64-bit length */
+#define MAX_HEADER      (HVAL_SIZE + 1 + 2 * MAX_VARINT)
+
+#define make_tag(key,value)  ((key) | ((value) << 2))
+#define tag_key(tag)         ((tag) & 3)
+#define tag_value(tag)       ((tag) >> 2)	/* 0 if deleted, else 1 + type */
+#define has_number(v)        ((v) == 1 + C_DOUBLE || (v) == 1 + C_STRNUM)
+#define has_string(v)        ((v) > 1 + C_DOUBLE)
+
+#ifdef HAVE_FSEEKO
+typedef off_t FILE_OFFSET;
+#define seek_offset(fp,offset) fseeko(fp, offset, SEEK_SET)
+#else
+typedef long FILE_OFFSET;
+#define seek_offset(fp,offset) fseek(fp, offset, SEEK_SET)
+#endif
+
+#define HALF_OFFSET     ((FILE_OFFSET) 1 << (sizeof(FILE_OFFSET) * 8 - 2))
+#ifndef MAX_RUN_BYTES
+#define MAX_RUN_BYTES   (HALF_OFFSET - 1 + HALF_OFFSET)
+#endif
+
+typedef struct {
+    unsigned hval;		/* of the first record of a block */
+    FILE_OFFSET offset;
+} RUN_INDEX;
+
+typedef struct {
+    FILE *fp;
+    FILE_OFFSET bytes;
+    size_t records;
+    size_t links;		/* the SPILL and the streams reading the run */
+    RUN_INDEX *index;
+    size_t nindex;
+    size_t index_limit;
+    unsigned char *bloom;
+    unsigned bloom_mask;	/* its size in bits, less one */
+} RUN;
+
+struct _spill {
+    RUN **runs;			/* the oldest first */
+    size_t nruns;
+    size_t limit;
+    RUN *next;			/* the run being written */
+    size_t left;		/* records which spill_begin() allowed for */
+};
+
+typedef struct {
+    RUN *run;
+    FILE_OFFSET offset;		/* of buf in the file */
+    char *buf;
+    size_t size;
+    size_t used;
+    size_t pos;			/* of the current record in buf */
+    FILE_OFFSET stop;		/* reads go no further unless a record does */
+} READER;
+
+/* a record, pointing into the buffer of the reader which read it */
+typedef struct {
+    SPILL_KEY key;
+    int value;			/* tag_value() */
+    double dval;
+    const char *vstr;
+    size_t vlen;
+    size_t size;		/* of the record */
+} RECORD;
+
+/* what a stream holds of each run */
+#define AT_END          0
+#define AT_RECORD       1
+#define TO_SKIP         2	/* a key which was given */
+
+struct _spill_stream {
+    size_t nruns;
+    RUN **runs;
+    READER *readers;
+    RECORD *records;
+    int *state;
+};
+
+static READER finder;		/* for lookups */
+static size_t spill_count;	/* of SPILLs, to free finder with the last */
+
+static GCC_NORETURN void
+spill_failed(const char *what)
+{
+    errmsg(errno, "cannot %s a temporary file for -W spill", what);
+    mawk_exit(2);
+    /* NOTREACHED */
+}
+
+/* can a run of used bytes take size more? */
+static int
+run_has_room(
+		FILE_OFFSET used,
+		size_t size)
+{
+    return (size <= (size_t) MAX_RUN_BYTES
+	    && used <= MAX_RUN_BYTES - (FILE_OFFSET) size);
+}
+
+/* scatter the bits of a hash value which the table may not have mixed */
+static unsigned
+bloom_mix(unsigned h)
+{
+    h ^= h >> 16;
+    h *= 0x7FEB352DU;
+    h ^= h >> 15;
+    h *= 0x846CA68BU;
+    return h ^ (h >> 16);
+}
+
+static void
+bloom_add(RUN * rp, unsigned hval)
+{
+    unsigned h = bloom_mix(hval);
+    unsigned step = ((h >> 17) | (h << 15)) | 1;
+    int k;
+
+    for (k = 0; k < BLOOM_PROBES; k++, h += step)
+	rp->bloom[(h & rp->bloom_mask) >> 3] |= (unsigned char) (1 << (h & 7));
+}
+
+static int
+bloom_has(const RUN * rp, unsigned hval)
+{
+    unsigned h = bloom_mix(hval);
+    unsigned step = ((h >> 17) | (h << 15)) | 1;
+    int k;
+
+    for (k = 0; k < BLOOM_PROBES; k++, h += step) {
+	if (!(rp->bloom[(h & rp->bloom_mask) >> 3] & (1 << (h & 7))))
+	    return 0;
+    }
+    return 1;
+}
+
+/* a run for at most cnt records */
+static RUN *
+new_run(size_t cnt)
+{
+    RUN *rp = ZMALLOC(RUN);
+    size_t bits = 64;
+
+    while (bits < cnt * BLOOM_BITS && bits < ((size_t) 1 << 31))
+	bits <<= 1;
+    if ((rp->fp = tmpfile()) == NULL)
+	spill_failed("open");
+    rp->bytes = 0;
+    rp->records = 0;
+    rp->links = 1;
+    rp->nindex = 0;
+    rp->index_limit = cnt / INDEX_STEP + 1;
+    rp->index = (RUN_INDEX *) zmalloc(rp->index_limit * sizeof(RUN_INDEX));
+    rp->bloom = (unsigned char *) memset(zmalloc(bits / 8), 0, bits / 8);
+    rp->bloom_mask = (unsigned) (bits - 1);
+    return rp;
+}
+
+static void
+release_run(RUN * rp)
+{
+    if (--rp->links == 0) {
+	fclose(rp->fp);
+	zfree(rp->index, rp->index_limit * sizeof(RUN_INDEX));
+	zfree(rp->bloom, (size_t) rp->bloom_mask / 8 + 1);
+	ZFREE(rp);
+    }
+}
+
+/* account for a record just written */
+static void
+note_record(
+	       RUN * rp,
+	       unsigned hval,
+	       size_t size)
+{
+    if (!run_has_room(rp->bytes, size)) {
+#ifdef EFBIG
+	errno = EFBIG;
+#endif
+	spill_failed("write");
+    }
+    if (rp->records % INDEX_STEP == 0) {
+	rp->index[rp->nindex].hval = hval;
+	rp->index[rp->nindex].offset = rp->bytes;
+	rp->nindex++;
+    }
+    bloom_add(rp, hval);
+    rp->records++;
+    rp->bytes += (FILE_OFFSET) size;
+}
+
+static void
+write_bytes(
+	       RUN * rp,
+	       const void *p,
+	       size_t n)
+{
+    if (n != 0 && fwrite(p, 1, n, rp->fp) != n)
+	spill_failed("write");
+}
+
+static void
+finish_run(RUN * rp)
+{
+    if (fflush(rp->fp) != 0 || ferror(rp->fp))
+	spill_failed("write");
+}
+
+static size_t
+put_varint(
+	      unsigned char *s,
+	      size_t v)
+{
+    size_t n = 0;
+
+    while (v >= 0x80) {
+	s[n++] = (unsigned char) (v | 0x80);
+	v >>= 7;
+    }
+    s[n++] = (unsigned char) v;
+    return n;
+}
+
+static void
+reader_init(
+	       READER * rd,
+	       RUN * rp,
+	       FILE_OFFSET offset,
+	       FILE_OFFSET stop)
+{
+    if (rd->buf == NULL) {
+	rd->size = READ_BLOCK;
+	rd->buf = (char *) zmalloc(rd->size);
+    }
+    rd->run = rp;
+    rd->offset = offset;
+    rd->stop = stop;
+    rd->used = rd->pos = 0;
+}
+
+static void
+reader_free(READER * rd)
+{
+    if (rd->buf != NULL) {
+	zfree(rd->buf, rd->size);
+	rd->buf = NULL;
+    }
+}
+
+/* make n bytes from the current record on available, unless the run ends */
+static int
+reader_need(
+	       READER * rd,
+	       size_t n)
+{
+    RUN *rp = rd->run;
+    FILE_OFFSET stop = rd->stop;
+    size_t want;
+    size_t left;
+
+    if (rd->used - rd->pos >= n)
+	return 1;
+    if (rd->pos != 0) {
+	memmove(rd->buf, rd->buf + rd->pos, rd->used - rd->pos);
+	rd->offset += (FILE_OFFSET) rd->pos;
+	rd->used -= rd->pos;
+	rd->pos = 0;
+    }
+    if (n > rd->size) {
+	size_t size = rd->size;
+	while (size < n)
+	    size *= 2;
+	rd->buf = (char *) zrealloc(rd->buf, rd->size, size);
+	rd->size = size;
+    }
+    if (stop < rd->offset + (FILE_OFFSET) n)
+	stop = rp->bytes;
+    want = rd->size - rd->used;
+    left = (size_t) (stop - rd->offset) - rd->used;
+    if (want > left)
+	want = left;
+    if (rd->used + want < n)
+	return 0;
+    if (seek_offset(rp->fp, rd->offset + (FILE_OFFSET) rd->used) != 0
+	|| fread(rd->buf + rd->used, 1, want, rp->fp) != want)
+	spill_failed("read");
+    rd->used += want;
+    return 1;
+}
+
+static size_t
+get_varint(
+	      READER * rd,
+	      size_t *headp)
+{
+    size_t v = 0;
+    int shift = 0;
+    unsigned char c;
+
+    do {
+	if (!reader_need(rd, *headp + 1))
+	    spill_failed("read");
+	c = (unsigned char) rd->buf[rd->pos + (*headp)++];
+	v |= (size_t) (c & 0x7f) << shift;
+	shift += 7;
+    } while (c & 0x80);
+    return v;
+}
+
+/* parse the record at the reader, returning 0 at the end of the run */
+static int
+read_record(
+	       READER * rd,
+	       RECORD * rec)
+{
+    size_t head = HVAL_SIZE + 1;
+    size_t klen = sizeof(Int);
+    size_t nlen;
+    const char *s;
+    int tag;
+
+    if (!reader_need(rd, head))
+	return 0;
+    tag = (unsigned char) rd->buf[rd->pos + HVAL_SIZE];
+    rec->key.kind = tag_key(tag);
+    rec->value = tag_value(tag);
+    if (rec->key.kind == SKEY_STR)
+	klen = get_varint(rd, &head);
+    rec->vlen = has_string(rec->value) ? get_varint(rd, &head) : 0;
+    nlen = has_number(rec->value) ? sizeof(double) : 0;
+    rec->size = head + klen + nlen + rec->vlen;
+    if (!reader_need(rd, rec->size))
+	spill_failed("read");
+
+    s = rd->buf + rd->pos;
+    memcpy(&rec->key.hval, s, HVAL_SIZE);
+    s += head;
+    if (rec->key.kind == SKEY_STR) {
+	rec->key.str = s;
+	rec->key.len = klen;
+	rec->key.ival = 0;
+    } else {
+	memcpy(&rec->key.ival, s, sizeof(Int));
+	rec->key.str = NULL;
+	rec->key.len = 0;
+    }
+    s += klen;
+    if (nlen)
+	memcpy(&rec->dval, s, sizeof(double));
+    rec->vstr = s + nlen;
+    return 1;
+}
+
+/* the value of a record which has one */
+static void
+record_value(
+		const RECORD * rec,
+		CELL *cp)
+{
+    cp->type = (short) (rec->value - 1);
+    if (has_number(rec->value))
+	cp->dval = rec->dval;
+    if (has_string(rec->value))
+	cp->ptr = (PTR) new_STRING1(rec->vstr, rec->vlen);
+}
+
+SPILL
+spill_new(void)
+{
+    SPILL sp = ZMALLOC(struct _spill);
+
+    sp->runs = NULL;
+    sp->nruns = sp->limit = sp->left = 0;
+    sp->next = NULL;
+    spill_count++;
+    return sp;
+}
+
+void
+spill_free(SPILL sp)
+{
+    while (sp->nruns != 0)
+	release_run(sp->runs[--sp->nruns]);
+    if (sp->limit)
+	zfree(sp->runs, sp->limit * sizeof(RUN *));
+    ZFREE(sp);
+    if (--spill_count == 0)
+	reader_free(&finder);
+}
+
+/* the order of the records in a run */
+int
+spill_compare(
+		 const SPILL_KEY * a,
+		 const SPILL_KEY * b)
+{
+    int result;
+
+    if (a->hval != b->hval)
+	return (a->hval < b->hval) ? -1 : 1;
+    if (a->kind != b->kind)
+	return a->kind - b->kind;
+    if (a->kind != SKEY_STR)
+	return (a->ival > b->ival) - (a->ival < b->ival);
+    result = memcmp(a->str, b->str, (a->len < b->len) ? a->len : b->len);
+    if (result == 0)
+	result = (a->len > b->len) - (a->len < b->len);
+    return result;
+}
+
+/* start a run of at most cnt records, given in order by spill_put() */
+void
+spill_begin(
+	       SPILL sp,
+	       size_t cnt)
+{
+    sp->next = new_run(cnt);
+    sp->left = cnt;
+}
+
+/* add a complete run as the newest */
+static void
+add_run(
+	   SPILL sp,
+	   RUN * rp)
+{
+    if (sp->nruns == sp->limit) {
+	size_t limit = sp->limit ? 2 * sp->limit : 8;
+	if (sp->limit)
+	    sp->runs = (RUN **) zrealloc(sp->runs,
+					 sp->limit * sizeof(RUN *),
+					 limit * sizeof(RUN *));
+	else
+	    sp->runs = (RUN **) zmalloc(limit * sizeof(RUN *));
+	sp->limit = limit;
+    }
+    sp->runs[sp->nruns++] = rp;
+}
+
+/* write the key with the value at cp, or as deleted if cp is null */
+void
+spill_put(
+	     SPILL sp,
+	     const SPILL_KEY * kp,
+	     const CELL *cp)
+{
+    RUN *rp = sp->next;
+    unsigned char head[MAX_HEADER + sizeof(Int) + sizeof(double)];
+    size_t n = HVAL_SIZE + 1;
+    int value = cp ? cp->type + 1 : 0;
+    size_t vlen = 0;
+    size_t size;
+
+    if (cp != NULL && (cp->type < C_NOINIT || cp->type > C_MBSTRN))
+	bozo("spill_put");
+    size = (n + 2 * MAX_VARINT
+	    + (kp->kind == SKEY_STR ? kp->len : sizeof(Int))
+	    + (has_number(value) ? sizeof(double) : 0)
+	    + (has_string(value) ? string(cp)->len : 0));
+    if (rp->records != 0 && !run_has_room(rp->bytes, size)) {
+	/* the keys so far make a run, and the rest another */
+	finish_run(rp);
+	add_run(sp, rp);
+	rp = sp->next = new_run(sp->left);
+    }
+    sp->left--;
+    memcpy(head, &kp->hval, HVAL_SIZE);
+    head[HVAL_SIZE] = (unsigned char) make_tag(kp->kind, value);
+    if (kp->kind == SKEY_STR)
+	n += put_varint(head + n, kp->len);
+    if (has_string(value)) {
+	vlen = string(cp)->len;
+	n += put_varint(head + n, vlen);
+    }
+    if (kp->kind != SKEY_STR) {
+	memcpy(head + n, &kp->ival, sizeof(Int));
+	n += sizeof(Int);
+	write_bytes(rp, head, n);
+    } else {
+	write_bytes(rp, head, n);
+	write_bytes(rp, kp->str, kp->len);
+	n += kp->len;
+    }
+    if (has_number(value)) {
+	write_bytes(rp, &cp->dval, sizeof(double));
+	n += sizeof(double);
+    }
+    if (vlen) {
+	write_bytes(rp, string(cp)->str, vlen);
+	n += vlen;
+    }
+    note_record(rp, kp->hval, n);
+}
+
+static SPILL_STREAM
+open_stream(
+	       RUN ** runs,
+	       size_t nruns)
+{
+    SPILL_STREAM st = ZMALLOC(struct _spill_stream);
+    size_t i;
+
+    st->nruns = nruns;
+    st->runs = NULL;
+    st->readers = NULL;
+    st->records = NULL;
+    st->state = NULL;
+    if (nruns != 0) {
+	st->runs = (RUN **) zmalloc(nruns * sizeof(RUN *));
+	st->readers = (READER *) zmalloc(nruns * sizeof(READER));
+	st->records = (RECORD *) zmalloc(nruns * sizeof(RECORD));
+	st->state = (int *) zmalloc(nruns * sizeof(int));
+    }
+    for (i = 0; i < nruns; i++) {
+	st->runs[i] = runs[i];
+	runs[i]->links++;
+	st->readers[i].buf = NULL;
+	reader_init(st->readers + i, runs[i], (FILE_OFFSET) 0, runs[i]->bytes);
+	st->state[i] = read_record(st->readers + i, st->records + i)
+	    ? AT_RECORD : AT_END;
+    }
+    return st;
+}
+
+/* the least key of the runs, from the newest run which has it, or null */
+static RECORD *
+stream_step(
+	       SPILL_STREAM st,
+	       size_t *whichp)
+{
+    size_t i;
+    size_t best = st->nruns;
+
+    for (i = 0; i < st->nruns; i++) {
+	if (st->state[i] == TO_SKIP) {
+	    READER *rd = st->readers + i;
+	    rd->pos += st->records[i].size;
+	    st->state[i] = read_record(rd, st->records + i) ? AT_RECORD : AT_END;
+	}
+	if (st->state[i] == AT_RECORD
+	    && (best == st->nruns
+		|| spill_compare(&st->records[i].key, &st->records[best].key) <= 0))
+	    best = i;
+    }
+    if (best == st->nruns)
+	return NULL;
+    for (i = 0; i < st->nruns; i++) {
+	if (st->state[i] == AT_RECORD
+	    && (i == best
+		|| spill_compare(&st->records[i].key, &st->records[best].key) == 0))
+	    st->state[i] = TO_SKIP;
+    }
+    *whichp = best;
+    return st->records + best;
+}
+
+/* merge the runs from first on into one */
+static void
+merge_runs(
+	      SPILL sp,
+	      size_t first)
+{
+    SPILL_STREAM st = open_stream(sp->runs + first, sp->nruns - first);
+    size_t cnt = 0;
+    size_t i;
+    RUN *rp;
+    RECORD *rec;
+
+    for (i = first; i < sp->nruns; i++)
+	cnt += sp->runs[i]->records;
+    rp = new_run(cnt);
+    while ((rec = stream_step(st, &i)) != NULL) {
+	if (rec->value == 0 && first == 0)
+	    continue;		/* there is no older copy to hide */
+	write_bytes(rp, st->readers[i].buf + st->readers[i].pos, rec->size);
+	note_record(rp, rec->key.hval, rec->size);
+    }
+    spill_close(st);
+    finish_run(rp);
+    for (i = first; i < sp->nruns; i++)
+	release_run(sp->runs[i]);
+    sp->nruns = first;
+    if (rp->records != 0)
+	sp->runs[sp->nruns++] = rp;
+    else
+	release_run(rp);
+}
+
+/* the run begun by spill_begin() is complete */
+void
+spill_end(SPILL sp)
+{
+    RUN *rp = sp->next;
+
+    sp->next = NULL;
+    finish_run(rp);
+    if (rp->records == 0) {
+	release_run(rp);
+	return;
+    }
+    add_run(sp, rp);
+    while (sp->nruns >= 2
+	   && sp->runs[sp->nruns - 2]->records <= sp->runs[sp->nruns - 1]->records
+	   && (sp->runs[sp->nruns - 2]->bytes
+	       <= MAX_RUN_BYTES - sp->runs[sp->nruns - 1]->bytes))
+	merge_runs(sp, sp->nruns - 2);
+}
+
+/* 1 if the run has the key with a value, 0 if deleted, -1 if it lacks it */
+static int
+run_find(
+	    RUN * rp,
+	    const SPILL_KEY * kp,
+	    CELL *cp)
+{
+    size_t lo = 0;
+    size_t hi = rp->nindex;
+    FILE_OFFSET stop;
+    RECORD rec;
+
+    if (!bloom_has(rp, kp->hval))
+	return -1;
+    /* the records of the key begin after the last entry below it */
+    while (lo < hi) {
+	size_t mid = (lo + hi) / 2;
+	if (rp->index[mid].hval < kp->hval)
+	    lo = mid + 1;
+	else
+	    hi = mid;
+    }
+    /* and end before the next entry, unless it has the same hash value */
+    if (lo < rp->nindex && rp->index[lo].hval > kp->hval)
+	stop = rp->index[lo].offset;
+    else
+	stop = rp->bytes;
+    reader_init(&finder, rp, rp->index[lo ? lo - 1 : 0].offset, stop);
+    while (finder.offset + (FILE_OFFSET) finder.pos < stop
+	   && read_record(&finder, &rec)
+	   && rec.key.hval <= kp->hval) {
+	if (rec.key.hval == kp->hval && spill_compare(&rec.key, kp) == 0) {
+	    if (rec.value == 0)
+		return 0;
+	    if (cp != NULL)
+		record_value(&rec, cp);
+	    return 1;
+	}
+	finder.pos += rec.size;
+    }
+    return -1;
+}
+
+/* is the key in the runs, and not deleted?  If so, its value goes in *cp */
+int
+spill_find(
+	      SPILL sp,
+	      const SPILL_KEY * kp,
+	      CELL *cp)
+{
+    size_t i = sp->nruns;
+
+    while (i-- > 0) {
+	int found = run_find(sp->runs[i], kp, cp);
+	if (found >= 0)
+	    return found;
+    }
+    return 0;
+}
+
+/* walk the keys in the runs as they are now, merging them */
+SPILL_STREAM
+spill_open(SPILL sp)
+{
+    return open_stream(sp->runs, sp->nruns);
+}
+
+/*
+ * Put the next key in *kp, and its value in *cp unless that is null,
+ * returning 0 at the end.  A string key points into the stream, until
+ * the next call.
+ */
+int
+spill_next(
+	      SPILL_STREAM st,
+	      SPILL_KEY * kp,
+	      CELL *cp)
+{
+    RECORD *rec;
+    size_t i;
+
+    while ((rec = stream_step(st, &i)) != NULL) {
+	if (rec->value != 0) {
+	    *kp = rec->key;
+	    if (cp != NULL)
+		record_value(rec, cp);
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+void
+spill_close(SPILL_STREAM st)
+{
+    size_t i;
+
+    for (i = 0; i < st->nruns; i++) {
+	reader_free(st->readers + i);
+	release_run(st->runs[i]);
+    }
+    if (st->nruns != 0) {
+	zfree(st->runs, st->nruns * sizeof(RUN *));
+	zfree(st->readers, st->nruns * sizeof(READER));
+	zfree(st->records, st->nruns * sizeof(RECORD));
+	zfree(st->state, st->nruns * sizeof(int));
+    }
+    ZFREE(st);
+}
+
+size_t
+spill_runs(SPILL sp)
+{
+    return sp->nruns;
+}
+
+/* for -W stats, the records and bytes in the runs, and the memory they use */
+void
+spill_stats(
+	       SPILL sp,
+	       size_t *records,
+	       size_t *bytes,
+	       size_t *memory)
+{
+    size_t i;
+
+    *records = *bytes = *memory = 0;
+    for (i = 0; i < sp->nruns; i++) {
+	RUN *rp = sp->runs[i];
+	*records += rp->records;
+	*bytes += (size_t) rp->bytes;
+	*memory += (sizeof(RUN)
+		    + rp->index_limit * sizeof(RUN_INDEX)
+		    + (size_t) rp->bloom_mask / 8 + 1);
+    }
+}
@@ -0,0 +1,52 @@
+/********************************************
+spill.h
+copyright 2026 Thomas E. Dickey
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 2, 1991.
+********************************************/
+
+/*
+ * $MawkId: spill.h,v 1.1 2026/10/19 00:00:00 tom Exp $
+ */
+
+/* spill.h */
+
+#ifndef MAWK_SPILL_H
+#define MAWK_SPILL_H
+
+#include <types.h>
+
+/* the key of an array element, in the canonical form array.c gives it */
+typedef struct {
+    unsigned hval;		/* as the table of the array hashes it */
+    int kind;			/* SKEY_INT, SKEY_PAIR or SKEY_STR */
+    Int ival;
+    const char *str;
+    size_t len;
+} SPILL_KEY;
+
+#define SKEY_INT        0
+#define SKEY_PAIR       1
+#define SKEY_STR        2
+
+typedef struct _spill *SPILL;	/* the runs of one array */
+typedef struct _spill_stream *SPILL_STREAM;
+
+extern SPILL spill_new(void);
+extern void spill_free(SPILL);
+extern int spill_compare(const SPILL_KEY *, const SPILL_KEY *);
+extern void spill_begin(SPILL, size_t);
+extern void spill_put(SPILL, const SPILL_KEY *, const CELL *);
+extern void spill_end(SPILL);
+extern int spill_find(SPILL, const SPILL_KEY *, CELL *);
+extern SPILL_STREAM spill_open(SPILL);
+extern int spill_next(SPILL_STREAM, SPILL_KEY *, CELL *);
+extern void spill_close(SPILL_STREAM);
+extern size_t spill_runs(SPILL);
+extern void spill_stats(SPILL, size_t *, size_t *, size_t *);
+
+#endif /* MAWK_SPILL_H */
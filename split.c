@@ -165,8 +165,13 @@ re_pos_match(char *str, size_t str_len, RE_NODE * re, size_t *lenp, int no_bol)
     const char *end = str + str_len;
 
     while (str < end) {
-	char *match = REmatch(str, (size_t) (end - str),
-			      cast_to_re(re), lenp, no_bol);
+	char *match;
+
+	/* an anchored pattern cannot match after the beginning */
+	if (no_bol && isAnchored(re))
+	    break;
+	match = REmatch(str, (size_t) (end - str),
+			cast_to_re(re), lenp, no_bol);
 	if (match) {
 	    if (*lenp) {
 		/* match of positive length so done */
@@ -209,12 +214,12 @@ null_split(const char *s, size_t slen)
 
 /*
  * The caller knows there are cnt STRING* in the split_block_list
- * buffers.  This function uses them to make CELLs in cp[]
- * The target CELLs are virgin, they don't need to be
+ * buffers.  This function uses them to make cnt CELLs, step bytes
+ * apart from cp.  The target CELLs are virgin, they don't need to be
  * destroyed
  */
 void
-transfer_to_array(CELL cp[], size_t cnt)
+transfer_to_array(CELL *cp, size_t step, size_t cnt)
 {
     Split_Block_Node *node_p = split_block_list;
     unsigned idx = 0;
@@ -222,7 +227,7 @@ transfer_to_array(CELL cp[], size_t cnt)
 	cp->type = C_MBSTRN;
 	cp->ptr = (PTR) node_p->strings[idx];
 	cnt--;
-	cp++;
+	cp = (CELL *) (PTR) ((char *) cp + step);
 	if (++idx == SP_SIZE) {
 	    idx = 0;
 	    node_p = node_p->link;
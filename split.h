@@ -24,7 +24,7 @@ the GNU General Public License, version 2, 1991.
 extern size_t null_split(const char *s, size_t slen);
 extern size_t re_split(char *s, size_t slen, PTR re);
 extern size_t space_split(const char *s, size_t slen);
-extern void transfer_to_array(CELL cp[], size_t cnt);
+extern void transfer_to_array(CELL *cp, size_t step, size_t cnt);
 extern void transfer_to_fields(size_t cnt);
 
 #endif /* MAWK_SPLIT_H */
@@ -179,11 +179,14 @@ extern void relocate_resolve_list(int, int, const FBLOCK *, int, unsigned, int);
 /* hash.c */
 extern unsigned hash(const char *);
 extern unsigned hash2(const char *, size_t);
+extern unsigned string_hash(STRING *);
+extern unsigned hash_seed;
 extern SYMTAB *insert(const char *);
 extern SYMTAB *find(const char *);
 extern const char *reverse_find(int, PTR);
 extern SYMTAB *save_id(const char *);
 extern void restore_ids(void);
+extern void hash_walk(void (*)(SYMTAB *));
 
 /* error.c */
 extern const char *type_to_str(int);
@@ -0,0 +1,388 @@
+# $MawkId: array.awk,v 1.1 2026/10/19 00:00:00 tom Exp $
+# Test-script for MAWK
+###############################################################################
+# copyright 2026, Thomas E. Dickey
+#
+# This is a source file for mawk, an implementation of
+# the AWK programming language.
+#
+# Mawk is distributed without warranty under the terms of
+# the GNU General Public License, version 2, 1991.
+###############################################################################
+# open-addressed tables grow, and deleting keeps the others reachable
+BEGIN {
+	for (i = 0; i < 5000; i++) {
+		tab["s" i] = i
+		tab[i * 1024] = -i
+		tab[-i - 1] = i
+	}
+	for (i = 0; i < 5000; i += 2) {
+		delete tab["s" i]
+		delete tab[i * 1024]
+	}
+	for (i = 0; i < 5000; i++) {
+		if (("s" i in tab) == (i % 2))
+			tab_found++
+		if ((i * 1024 in tab) == (i % 2))
+			tab_found++
+		if (tab[-i - 1] == i)
+			tab_found++
+	}
+	for (i = 0; i < 5000; i += 4)
+		tab["s" i] = "again"
+	for (k in tab) {
+		tab_looped++
+		if (tab[k] == "again")
+			tab_again++
+	}
+	print "table lookups after deleting:", tab_found
+	print "table keys in a loop:", tab_looped
+	print "table keys added again:", tab_again
+	print "table length:", length(tab)
+	print "table string key added again:", tab["s4"]
+	print "table string key kept:", tab["s5"]
+	print "table integer key kept:", tab[5 * 1024]
+	print "table negative key kept:", tab[-5000]
+	delete tab
+	tab["x"]
+	print "table length after delete:", length(tab)
+	print "table new key after delete:", ("x" in tab)
+	print "table old key after delete:", (0 in tab)
+}
+# integer subscripts and their decimal strings are the same key
+BEGIN {
+	key[12] = "n"
+	key["12"] = key["12"] "s"
+	key[-7] = 1
+	key[1e3] = "e"
+	key[-0] = "z"
+	key["012"] = "lz"
+	key["+12"] = "p"
+	key["-0"] = "mz"
+	key["12.0"] = "f"
+	key[" 12"] = "sp"
+	key[0.5] = "h"
+	CONVFMT = "%.2f"
+	key[0.25] = "q"
+	CONVFMT = "%.6g"
+	print "integer keys length:", length(key)
+	print "integer key 12 and \"12\":", key[12]
+	print "integer key \"-7\":", key["-7"]
+	print "integer key \"1000\" for 1e3:", key["1000"]
+	print "integer key 0 for -0:", key[0]
+	print "integer key \"0\" for -0:", key["0"]
+	print "integer key -0.0:", key[-0.0]
+	print "string key \"012\":", key["012"]
+	print "string key \"+12\":", key["+12"]
+	print "string key \"-0\":", key["-0"]
+	print "string key \"12.0\":", key["12.0"]
+	print "string key \" 12\":", key[" 12"]
+	print "string key 0.5:", key["0.5"]
+	print "string key 0.25 with CONVFMT:", key["0.25"]
+	print "integer key 12 in:", (12 in key)
+	print "integer key \"12\" in:", ("12" in key)
+	print "integer key 11 + 1 in:", (11 + 1 in key)
+	print "string key \"1e3\" in:", ("1e3" in key)
+	print "integer key 1000 in:", (1000 in key)
+	print "string key 0.25 in:", (0.25 in key)
+	for (k in key)
+		if (k ~ /^-?[0-9]+$/)
+			key_sum = key_sum + k
+	print "integer keys sum:", key_sum
+	key[-2^63] = "min"
+	key["-9223372036854775808"] = key["-9223372036854775808"] "s"
+	key[-2^53] = "m53"
+	key["-9007199254740992"] = key["-9007199254740992"] "s"
+	print "integer key -2^63:", key[-2^63]
+	print "integer key -2^53:", key[-2^53]
+	print "integer keys length at the limits:", length(key)
+}
+# subscripts of every length hash alike whatever the seed
+BEGIN {
+	chars = "abcdefghijklmnopqrstuvwxyz0123456789"
+	for (i = 0; i < 1000; i++) {
+		k = substr(chars, 1, i % 37) i
+		seeded[k] = i
+	}
+	for (i = 0; i < 1000; i++) {
+		k = substr(chars, 1, i % 37) i
+		if (seeded[k] == i)
+			seeded_found++
+	}
+	for (k in seeded)
+		seeded_looped++
+	k = sprintf("%300s", "")
+	seeded[k] = "long"
+	seeded[k "x"] = "longer"
+	print "hashed keys found:", seeded_found
+	print "hashed keys in a loop:", seeded_looped
+	print "hashed long key:", seeded[sprintf("%300s", "")]
+	print "hashed longer key:", seeded[sprintf("%300s", "") "x"]
+	print "hashed keys length:", length(seeded)
+}
+# a for-in loop visits the keys present when it began, however the array changes
+BEGIN {
+	for (i = 1; i <= 40; i++)
+		live[i]
+	for (k in live) {
+		delete live[k]
+		live["x" k]
+		live_visited++
+	}
+	split("a b c", parts)
+	for (k in parts) {
+		if (k == 1)
+			split("x", parts)
+		parts_sum += k
+	}
+	for (k in live) {
+		if (!live_cleared++)
+			delete live
+		cleared_visited++
+	}
+	print "loop keys while adding:", live_visited
+	print "loop keys after split:", parts_sum
+	print "loop keys after delete:", cleared_visited
+	print "loop array length after delete:", length(live)
+}
+# loop keys past 2^53 are strings, which name the same elements
+BEGIN {
+	huge["9223372036854775807"] = 1
+	huge[2^63] = 2
+	huge[-2^63] = 3
+	huge["-9223372036854775807"] = 4
+	huge[2^53] = 5
+	huge[2^53 + 2] = 6
+	huge["9007199254740993"] = 7
+	huge[-2^53] = 8
+	for (k in huge) {
+		huge_found = huge_found (k in huge) ((k "") in huge)
+		huge_sum = huge_sum + huge[k]
+	}
+	print "huge keys length:", length(huge)
+	print "huge loop keys found:", huge_found
+	print "huge loop values sum:", huge_sum
+	print "huge key 2^53:", huge["9007199254740992"]
+	print "huge key 2^63 - 1:", huge["9223372036854775807"]
+}
+# asort() and asorti() return the count, breaking ties by the index
+function joined(arr, n,  i, s) {
+	s = arr[1]
+	for (i = 2; i <= n; i++)
+		s = s " " arr[i]
+	return s
+}
+BEGIN {
+	split("b 10 a 9 c", unsorted)
+	sorted_count = asort(unsorted, sorted)
+	print "asort values:", joined(sorted, sorted_count)
+	indices_count = asorti(unsorted, by_value, "val_str_desc")
+	print "asorti indices by val_str_desc:", joined(by_value, indices_count)
+	print "asort in place count:", asort(unsorted)
+	print "asort in place last:", unsorted[5]
+	print "asort in place length:", length(unsorted)
+	split("3 1 2 1 3", ties)
+	ties["x"] = 1
+	asorti(ties, tied, "val_num_asc")
+	print "asorti ties by val_num_asc:", joined(tied, 6)
+	print "asorti of an empty array:", asorti(no_elements)
+	print "asort onto itself count:", asort(ties, ties, "val_num_desc")
+	print "asort onto itself first:", ties[1]
+	print "asort onto itself last:", ties[6]
+}
+# appending to an array with indices 1..n, past the first bank of cells
+BEGIN {
+	for (i = 1; i <= 3000; i++)
+		grown[i] = grown[i + 1] = i
+	delete grown[3001]
+	delete grown[3000]
+	for (k in grown)
+		grown_sum += k
+	more_count = split("x y", more)
+	more[more_count + 1] = "z"
+	more[5] = "w"
+	print "appended length:", length(grown)
+	print "appended last:", grown[2999]
+	print "appended keys sum:", grown_sum
+	print "appended string key in:", ("x" in grown)
+	print "appended to split length:", length(more)
+	print "appended to split:", more[3]
+}
+# an element being assigned keeps its cell when the array becomes a table
+BEGIN {
+	split("5 7 1", add)
+	for (i = 1; i <= 3; i++)
+		cum[i] = cum[i - 1] + add[i]
+	pend[1] = "a"
+	pend[2] = pend[5] "t"
+	this[1] = this["x"] "t"
+	cut_count = split("a b", cut)
+	cut[cut_count + 1] = cut["y"] "q"
+	for (i = 1; i <= 1500; i++)
+		bank[i] = i
+	bank[1501] = bank[-1] "w"
+	asort(add, add_sorted)
+	add_sorted[4] = add_sorted["k"] add_sorted[3]
+	print "pending sums:", cum[1], cum[2], cum[3]
+	print "pending append:", pend[2]
+	print "pending first element:", this[1]
+	print "pending append to split:", cut[3]
+	print "pending append to split length:", length(cut)
+	print "pending append past a bank:", bank[1501]
+	print "pending append past a bank last:", bank[1500]
+	print "pending append past a bank length:", length(bank)
+	print "pending append to asort:", add_sorted[4]
+}
+# counted elements read and change like any other
+BEGIN {
+	for (i = 0; i < 300; i++)
+		if (!counted[i % 100 "x"]++)
+			counted_first++
+	tally[-1]++
+	tally[2^40]--
+	tally["a"]++
+	tally["a"]++
+	tally_read = tally["a"]
+	tally[-1] = tally[-1] "z"
+	delete tally[2^40]
+	for (k in counted)
+		counted_sum += counted[k]
+	print "counted first times:", counted_first
+	print "counted sum:", counted_sum
+	print "counted value read:", tally_read
+	print "counted value as a string:", tally[-1]
+	print "counted length after delete:", length(tally)
+	print "counted predecrement:", --tally["a"]
+	print "counted postincrement:", tally["a"]++
+}
+# clearing an array between groups releases the strings its nodes hold
+BEGIN {
+	for (g = 1; g <= 3; g++) {
+		for (i = 0; i < 2000; i++) {
+			k = sprintf("%*d", i % 150, i)
+			groups[k]++
+			named[k] = k "v" g
+			if (i % 7 == 0)
+				delete named[k]
+		}
+		named_last = named[k]
+		delete groups
+		delete named
+		groups[g]++
+		named["x"] = named_last
+	}
+	sub(/^ */, "", named["x"])
+	print "cleared counts length:", length(groups)
+	print "cleared values length:", length(named)
+	print "cleared value kept:", named["x"]
+}
+# a[i,j] with integer subscripts is the same element as a[i SUBSEP j]
+BEGIN {
+	for (i = -2; i < 40; i++)
+		for (j = 0; j < 40; j++)
+			grid[i,j] = i * j
+	grid["3\0344"] = "s"
+	grid[2^25, 1] = "big"
+	twice[1,2]++
+	twice["1\0342"]++
+	delete grid[-2,5]
+	for (k in grid) {
+		split(k, pair_part, SUBSEP)
+		if (pair_part[1] * pair_part[2] == grid[k])
+			grid_products++
+	}
+	print "pair keys length:", length(grid)
+	print "pair keys split from a loop:", grid_products
+	print "pair key set as a string:", grid[3,4]
+	print "pair key past the packed range:", grid[33554432 "\0341"]
+	print "pair key in:", ((39,39) in grid)
+	print "pair key deleted in:", ((-2,5) in grid)
+	print "pair key counted both ways:", twice[1,2]
+	SUBSEP = ":"
+	grid[1,2] = "x"
+	print "pair key with another SUBSEP:", grid["1:2"]
+	print "pair key with the old SUBSEP:", grid["1\0342"]
+	SUBSEP = "\034"
+}
+# subscripts at the edges of a packed pair name the same elements as strings
+BEGIN {
+	split("-33554433 -33554432 33554431 33554432 0", edge)
+	for (i = 1; i <= 5; i++)
+		for (j = 1; j <= 5; j++) {
+			corner[edge[i] + 0, edge[j] + 0] = i j
+			corner_set++
+		}
+	for (i = 1; i <= 5; i++)
+		for (j = 1; j <= 5; j++)
+			if (corner[edge[i] SUBSEP edge[j]] == i j)
+				corner_strings++
+	for (k in corner) {
+		split(k, pair_part, SUBSEP)
+		if ((pair_part[1], pair_part[2]) in corner)
+			corner_looped++
+	}
+	corner[-0, 1.0] = "z"
+	corner["01", 2] = "y"
+	corner[1, 2] = "w"
+	print "edge pairs set:", corner_set
+	print "edge pairs found as strings:", corner_strings
+	print "edge pairs found from a loop:", corner_looped
+	print "edge pairs length:", length(corner)
+	print "edge pair of -0 and 1.0:", corner["0\0341"]
+	print "edge pair of \"01\" and 2:", corner["01\0342"]
+	print "edge pair of 1 and 2:", corner["1\0342"]
+	print "edge pair of 2^53 in:", ((2^53, 2^53) in corner)
+}
+# an array named by -W spill gives the same results from its temporary files
+BEGIN {
+	for (i = 0; i < 3000; i++)
+		if (!spilled[i % 1000 "k"]++)
+			spilled_first++
+	for (i = 0; i < 1000; i += 3)
+		delete spilled[i "k"]
+	for (i = 0; i < 50; i++) {
+		spilled_pairs[i, i % 7] = i
+		spilled_pairs[i] = "v" i
+	}
+	for (k in spilled) {
+		spilled_looped++
+		spilled_sum += spilled[k]
+	}
+	for (k in spilled_pairs)
+		pairs_looped++
+	print "spilled first times:", spilled_first
+	print "spilled length:", length(spilled)
+	print "spilled keys in a loop:", spilled_looped
+	print "spilled values sum:", spilled_sum
+	print "spilled key in:", ("2k" in spilled)
+	print "spilled key deleted in:", ("3k" in spilled)
+	print "spilled value:", spilled["4k"]
+	print "spilled pair value:", spilled_pairs[10,3]
+	print "spilled integer key value:", spilled_pairs[49]
+	print "spilled pairs length:", length(spilled_pairs)
+	print "spilled pairs in a loop:", pairs_looped
+	delete spilled_pairs
+	print "spilled pairs length after delete:", length(spilled_pairs)
+}
+# keys past 2^53 come back from the temporary files as strings, as in loops
+BEGIN {
+	for (i = -3; i <= 3; i++) {
+		spilled_big[2^53 + 2 * i] = i
+		spilled_big[-2^53 - 2 * i] = 10 * i
+	}
+	spilled_big["9223372036854775807"] = 100
+	spilled_big[-2^63] = 200
+	spilled_big["9007199254740993"] = 300
+	for (k in spilled_big) {
+		big_found = big_found + (k in spilled_big) + ((k "") in spilled_big)
+		big_past_1e17 += (k > 1e17)
+		big_sum += spilled_big[k]
+	}
+	print "spilled big keys length:", length(spilled_big)
+	print "spilled big loop keys found:", big_found
+	print "spilled big loop keys past 1e17:", big_past_1e17
+	print "spilled big values sum:", big_sum
+	print "spilled big key 2^53 + 2:", spilled_big["9007199254740994"]
+	print "spilled big key -2^53 - 4:", spilled_big[-9007199254740996]
+	print "spilled big key 2^63:", spilled_big[2^63]
+}
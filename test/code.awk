@@ -0,0 +1,163 @@
+# $MawkId: code.awk,v 1.1 2026/10/19 00:00:00 tom Exp $
+# Test-script for MAWK
+###############################################################################
+# copyright 2026, Thomas E. Dickey
+#
+# This is a source file for mawk, an implementation of
+# the AWK programming language.
+#
+# Mawk is distributed without warranty under the terms of
+# the GNU General Public License, version 2, 1991.
+###############################################################################
+# every kind of operator, statement and built-in goes through the dispatch
+BEGIN {
+	x = 7; y = 2; s = "ab"
+	print x + y, x - y, x * y, x / y, x % y, x ^ y, -x, +s, !x, !s, x y
+	a = x; a += 3; b = x; b -= 3; c = x; c *= 3; d = x; d /= 2; e = x; e %= 4; f = x; f ^= 2
+	print a, b, c, d, e, f, x++, ++x, x--, --x
+	print (x < y), (x <= y), (x > y), (x >= y), (x == y), (x != y), (s < "b"), (s == "ab")
+	print (s ~ /b$/), (s !~ "^a"), (x && 0), (0 || y), (x ? "t" : "f"), (1 in u), length(u)
+	$0 = "f1 f2 f3"; $5 = "f5"; print NF, $0; $2 = ""; NF = 2; print NF, $0 "|"
+	u["k"] = 1; u[1, 2]++; delete u["k"]; print length(u), ((1, 2) in u), ("k" in u)
+	n = split("p:q:r", v, ":"); print n, v[1] v[3], index("hello", "ll"), substr("hello", 2, 3)
+	t = "aXbX"; print sub(/X/, "-", t), t, gsub(/X/, "+", t), t, match(t, /b/), RSTART, RLENGTH
+	print length("four"), toupper("mIx"), tolower("MiX"), sprintf("%05.1f|%-3s|%c", 3.14159, "a", 66)
+	print int(-3.7), int(3.7), sqrt(16), exp(0), log(1), sin(0), cos(0), atan2(0, 1)
+	for (i = 0; i < 10; i++) { if (i == 2) continue; if (i == 5) break; w = w i }
+	do { w = w "d"; i-- } while (i > 3)
+	while (i < 6) i++
+	print w, i
+	printf "%s-%d-%x\n", "p", 42, 255
+}
+# sequences which are fused into superinstructions
+BEGIN {
+	n = t = 0
+	$0 = "150 abc 99.5 -2"
+	print ($1 > 100), ($2 > 100), ($3 < 100), ($4 >= -2.5), ($2 == 0)
+	for (i = 0; i < 5; i++) if (i != 3) n++
+	while (j <= 2.5) j += 0.5
+	print n, j, i * 2, i + 0.5, $1 * 2, $2 + 1, $3 - 0.5, i / 4, "7x" * 3
+	k++; k++; --k; c2["x"]++; c2["x"]++; c2[$2]--; print k, c2["x"], c2["abc"]
+	for (i = 1; i <= 6; i++) if (!seen[i % 3]++) firsts = firsts i
+	print firsts, seen[0], seen[1], seen[2]
+	z = 5; z += 2; z += "3"; q = z; print z, q, (r = 4) + 1
+	for (i = 0; i < 3; i++) { if (i == 1) continue; t += 10 }
+	print t, (i < 3 ? "lt" : "ge")
+	lim = 4; w = "10"; for (i = 0; i < lim; i++) if (i != lim - 1 && w > i) m++
+	print m, i * lim, w / lim, $1 - w, (w < lim), ($2 > w)
+}
+# integral values are printed and converted without sprintf
+BEGIN {
+	print 0, -0, 7, -7, 10, 99999, -100000, 2^31, -2^31, 2^53, -2^53, 2^63, 1e300
+	x = 2^53 + 0; y = -1234567890123; print x "", y "", (x "") + 0 == x, length(y "")
+	n = split("9 -9 1e3 0x10 3.0", parts, " "); for (i = 1; i <= n; i++) byval[parts[i] + 0] = parts[i]
+	for (i = -9; i <= 1000; i++) if (i in byval) h = h " " i "=" byval[i]
+	print h; OFMT = "%.2f"; CONVFMT = "%.3f"; print 3, 3.14159, 2^40, (5 "") (0.5 "")
+	$0 = ""; $3 = 12; $1 = -4; print $0 "|" NF
+	OFMT = CONVFMT = "%.6g"
+}
+# user functions can recurse deeply, and tail calls reuse the caller's frame
+function depth(n) { return n ? 1 + depth(n - 1) : 0 }
+function countdown(n) { return n ? countdown(n - 1) : "ok" }
+function sum_to(n, acc) { return n ? sum_to(n - 1, acc + n) : acc }
+function is_even(n) { return n ? is_odd(n - 1) : 1 }
+function is_odd(n) { return n ? is_even(n - 1) : 0 }
+function fill(arr, n,  key) { if (!n) return length(arr); key = "k" n; arr[key] = n; return fill(arr, n - 1) }
+function join(n,  s) { s = n; if (n > 1) s = join(n - 1) "," s; return s }
+BEGIN {
+	print depth(100000), countdown(1000000), sum_to(100000), is_even(100001), fill(filled, 500), filled["k7"]
+	print join(12)
+}
+# small functions are inlined; their locals start uninitialized at each call
+function larger(a, b) { return a > b ? a : b }
+function clamp(x, lo, hi) { return x < lo ? lo : x > hi ? hi : x }
+function wrap(x,  t) { t = t x; if (x > 1) return t; return "<" t ">" }
+function bump(v) { v++; return v }
+BEGIN {
+	for (i = 1; i <= 3; i++) {
+		largest = larger(largest, 4 - i)
+		wrapped = wrapped wrap(i)
+	}
+	print "inlined larger in a loop:", largest
+	print "inlined local at each call:", wrapped
+	print "inlined missing argument:", larger(2)
+	print "inlined string compare:", larger("abc", "abd")
+	print "inlined call of a call:", bump(bump(1))
+	$0 = "-5 3 12 x"
+	for (i = 1; i <= NF; i++)
+		clamped = clamped " " clamp($i, 0, 10)
+	print "inlined clamp of fields:", clamped
+	print "inlined clamp of a clamp:", clamp(clamp(20, 0, 15), 16, 18)
+	print "inlined larger of calls:", larger(larger(1, 9), larger(3, 4))
+}
+# NF is loaded once before a loop which cannot change the record
+function reset(s) { $0 = s }
+BEGIN {
+	$0 = "a b c"
+	for (i = 1; i <= NF; i++)
+		fields_read = fields_read $i
+	$0 = "d e"
+	for (i = 1; i <= NF; i++)
+		fields_read = fields_read $i
+	while (NF > 1)
+		NF--
+	print "fields of two records:", fields_read
+	print "record after NF--:", $0
+	$0 = "p q r"
+	for (i = 1; i <= NF; i++)
+		if (i == 1)
+			$0 = "w x y z"
+	print "loop end after assigning $0:", i
+	print "record after assigning $0:", $0
+	$0 = "1 2"
+	for (i = 1; i <= NF; i++)
+		if (i < 4)
+			$(i + 2) = "n"
+	print "loop end after assigning past NF:", i
+	print "record after assigning past NF:", $0
+	$0 = "x y"
+	for (i = 1; i <= NF; i++)
+		if (i == 1)
+			reset("u v w")
+	print "loop end after a function assigns $0:", i
+	print "record after a function assigns $0:", $0
+	$0 = "s t u"
+	for (i = 1; i <= NF; i++)
+		if (i == 1) {
+			getline < "reg8.dat"
+			close("reg8.dat")
+		}
+	print "loop end after getline:", i
+	print "record after getline:", $0
+}
+# a compare or arithmetic with a variable reads it without copying
+function set_global(v) { borrowed_global = v; return v }
+BEGIN {
+	upper = "c"
+	lower = "a"
+	steps = 0
+	while (lower < upper)
+		lower = substr("abc", ++steps + 1, 1)
+	ten = "10"
+	split("7", seven)
+	from_split = seven[1]
+	print "borrowed string compare steps:", steps
+	print "borrowed string compare result:", lower
+	print "borrowed string plus a number:", 1 + ten
+	print "borrowed split element times a number:", 2 * from_split
+	print "borrowed compare of a concatenation:", (lower "" >= upper)
+	operand = 1
+	print "borrowed operand plus its assignment:", operand + (operand = 5)
+	print "borrowed operand times its assignment:", operand * (operand = 3)
+	print "borrowed operand less than its assignment:", (operand < (operand = 2))
+	print "borrowed operand after the assignments:", operand
+	borrowed_global = 4
+	print "borrowed global minus a call which sets it:", borrowed_global - set_global(10)
+	print "borrowed global equal to a call which sets it:", (borrowed_global == set_global(11))
+	print "borrowed global after the calls:", borrowed_global
+	$0 = "3 4"
+	print "borrowed fields product:", $1 * $2
+	print "borrowed fields compare:", ($1 < $2)
+	print "borrowed field plus its assignment:", $1 + ($1 = 9)
+	print "borrowed record after the assignment:", $0
+}
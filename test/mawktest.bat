@@ -66,7 +66,8 @@ rem ####################################
 	%PROG% -f reg5.awk %dat% >> %STDOUT%
 	%PROG% -f reg6.awk %dat% >> %STDOUT%
 	%PROG% -f reg7.awk %dat% >> %STDOUT%
-	call :compare "reg0-reg7" %STDOUT% reg-awk.out
+	%PROG% -f reg8.awk %dat% >> %STDOUT%
+	call :compare "reg0-reg8" %STDOUT% reg-awk.out
 
 	echo ''Italics with an apostrophe' embedded'' | %PROG% -f noloop.awk
 	echo ''Italics with an apostrophe'' embedded'' | %PROG% -f noloop.awk
@@ -83,6 +84,18 @@ rem ######################################
 	call :begin testing arrays and flow of control
 	%PROG% -f wfrq0.awk %dat% > %STDOUT%
 	call :compare "array-test" %STDOUT% wfrq-awk.out
+	set MAWK_HASH_SEED=random
+	%PROG% -f array.awk > %STDOUT%
+	set MAWK_HASH_SEED=
+	call :compare "array" %STDOUT% array.out
+	%PROG% -W spill=spilled:10 -W spill=spilled_pairs:7 -W spill=spilled_big:3 -f array.awk > %STDOUT%
+	call :compare "array spill" %STDOUT% array.out
+	%PROG% -W order=ind_str_asc -v order=ind_str_asc -f order.awk > %STDOUT%
+	%PROG% -W order=ind_num_desc -v order=ind_num_desc -f order.awk >> %STDOUT%
+	%PROG% -W order=val_num_asc -v order=val_num_asc -f order.awk >> %STDOUT%
+	%PROG% -W order=val_str_desc -v order=val_str_desc -f order.awk >> %STDOUT%
+	%PROG% -W order=val_type_asc -v order=val_type_asc -f order.awk >> %STDOUT%
+	call :compare "order" %STDOUT% order.out
 
 rem ######################################
 
@@ -104,6 +117,8 @@ rem ################################
 	call :begin testing function calls and general stress test
 	%PROG% -f ../examples/decl.awk %dat% > %STDOUT%
 	call :compare "general" %STDOUT% decl-awk.out
+	%PROG% -f code.awk > %STDOUT%
+	call :compare "code" %STDOUT% code.out
 
 rem ######################################
 
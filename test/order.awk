@@ -0,0 +1,17 @@
+# $MawkId: order.awk,v 1.1 2026/10/19 00:00:00 tom Exp $
+# Test-script for MAWK
+###############################################################################
+# copyright 2026, Thomas E. Dickey
+#
+# This is a source file for mawk, an implementation of
+# the AWK programming language.
+#
+# Mawk is distributed without warranty under the terms of
+# the GNU General Public License, version 2, 1991.
+###############################################################################
+BEGIN {
+	split("b 10 a 9 c 10", v)
+	v["x"] = 3; v[-1] = "b"; v["10"] = "ten"
+	for (k in v) s = s " " k "=" v[k]
+	print order ":" s
+}
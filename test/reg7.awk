@@ -30,4 +30,17 @@ BEGIN {
 	str = "abbcb"; print gsub("b+",	"(&)", str), str
 	str = "a b c"; print gsub(/^[ 	]*/, "", str), str
 	str = " a b c"; print gsub(/^[ 	]*/, "", str), str
+	str = "abcabc"; print gsub("bc", "[&]", str), str
+	str = "a.b.c"; print gsub(".", "-", str), str
+	str = "a.b.c"; print gsub("\\.", "-", str), str
+	str = "abc"; print gsub("abcd", "X", str), str
+	str = "aaaa"; print gsub("aa", "<&>", str), str
+	str = "abab"; print gsub("ab", "\\&&", str), str
+	str = ""; print gsub("a", "X", str), "[" str "]"
+	str = ""; print gsub("x*", "X", str), "[" str "]"
+	str = "a+b a+b"; print gsub(/a\+b/, "&&", str), str
+	str = "abc"; print gsub("", "-", str), str
+	str = sprintf("%3000s", ""); n = gsub(" ", "ab", str); print n, length(str), substr(str, 5995)
+	str = sprintf("%3000s", ""); n = gsub(/ /, "", str); print n, "[" str "]"
+	$0 = "a b c"; print gsub(" ", ":"), NF, $0
 }
@@ -0,0 +1,57 @@
+# $MawkId: reg8.awk,v 1.1 2026/10/19 00:00:00 tom Exp $
+# Test-script for MAWK
+###############################################################################
+# copyright 2026, Thomas E. Dickey
+#
+# This is a source file for mawk, an implementation of
+# the AWK programming language.
+#
+# Mawk is distributed without warranty under the terms of
+# the GNU General Public License, version 2, 1991.
+###############################################################################
+BEGIN {
+	print match("1axa 1b", /[ab]*1/), RLENGTH
+	print match("x1", /[ab]*1/), RLENGTH
+	print match("1", /[ab]*1/), RLENGTH
+	print match("xaab1", /[ab]*1/), RLENGTH
+	print match("1caabcx", /[[:digit:]]*aa|c/), RLENGTH
+	print match("xx aa  b", /[ab]+ *$/), RLENGTH
+	print match("  12x", /^ *[0-9]*/), RLENGTH
+	print match("abc", /x[ab]*/), RLENGTH
+	print match("aab", /a[ab]*c|b/), RLENGTH
+	print ("1axa 1b" ~ /[ab]*1/), ("xyz" ~ /[ab]*1/), ("xyz" ~ /x[ab]*$/)
+	s = "1axa 1b"; print gsub(/[ab]*1/, "<&>", s), s
+	s = "a1 bb1 c"; print gsub(/[ab]*1/, "<&>", s), s
+	s = "aa-b"; print gsub(/[ab]*/, "<&>", s), s
+	s = sprintf("%5000s", ""); gsub(/ /, "ab", s)
+	print match(s, /(a|b)*c/), match(s "c", /(a|b)*c/), RLENGTH
+	print match(s, /((a|b)(a|b))*$/), RLENGTH
+	for (i = 0; i < 200; i++) p = p (i ? "|" : "") "k" i "z"
+	print match("k77 k199z", p), RLENGTH
+}
+BEGIN {
+	print match("abcab", /^ab/), RLENGTH, match("xab", /^ab/), match("", /^ab/), match("a", /^ab/)
+	print match("abcab", /ab$/), RLENGTH, match("abx", /ab$/), match("", /ab$/), match("b", /ab$/)
+	print match("ab", /^ab$/), RLENGTH, match("abab", /^ab$/), match("", /^ab$/), match("a", /^ab$/)
+	print ("" ~ /^$/), ("x" ~ /^$/), ("abc" ~ /^abc$/), ("abcd" ~ /^abc$/), ("ab" ~ /^abc/), ("bc" ~ /abc$/)
+	s = "abab"; print sub(/^ab/, "X", s), s
+	s = "abab"; print gsub(/ab$/, "X", s), s
+	s = "abab"; print gsub(/^ab/, "X", s), s
+	print split("abcab", a, /^ab/), a[1], a[2]
+	print split("abcab", a, /ab$/), a[1], a[2]
+}
+BEGIN {
+	FS = "^ab"; $0 = "abxy:ab"; print NF, $1, $2
+	FS = "ab$"; $0 = "abxy:ab"; print NF, $1, $2
+	FS = "^ab$"; $0 = "ab"; print NF, $1, $2
+	FS = "^ab$"; $0 = "abab"; print NF, $1, $2
+	FS = " "
+	n = split("^ab/ab$/ab\n$/^ab$/^abxabyab\n$/^abxabyab\nz", rs, "/")
+	for (i = 1; i <= n; i++) {
+		RS = rs[i]
+		while ((getline line < "reg8.dat") > 0)
+			printf "[%s]", line
+		close("reg8.dat")
+		print ""
+	}
+}
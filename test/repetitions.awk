@@ -41,3 +41,8 @@
 /(wabxcz){220}/ 
 /(wabxcz){221}/ 
 /wabxcz{219}w/
+END {
+	print match("xababc", /(ab){2,3}c/), RLENGTH
+	print match("xabababab", /(ab){2,3}/), RLENGTH
+	print match("aaaa", /a{2}b{0,1}a{1,}/), RLENGTH
+}
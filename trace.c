@@ -83,6 +83,9 @@ TraceCell(CELL *cp)
 	case C_REPLV:
 	    TRACE(("a vector replacement, count %d at %p\n", cp->vcnt, cp->ptr));
 	    break;
+	case C_PAIR:
+	    TRACE(("a pair of subscripts, packed %.0f\n", cp->dval));
+	    break;
 	case NUM_CELL_TYPES:
 	    /* FALLTHRU */
 	default:
@@ -116,6 +119,8 @@ TraceInst(INST * p, INST * base)
 	case AE_PUSHA:
 	case AE_PUSHI:
 	case A_PUSHA:
+	case AE_INCDEC:
+	case AE_INCDEC_V:
 	    TRACE(("\tST_ARRAY *%p\n", p->ptr));
 	    break;
 	case F_PUSHA:
@@ -134,13 +139,18 @@ TraceInst(INST * p, INST * base)
 	    TRACE(("\tregex *%p\n", p->ptr));
 	    break;
 	case _PUSHA:
+	case _INCDEC:
 	    TRACE(("\tST_VAR *%p\n", p->ptr));
 	    break;
 	case _PUSHC:
 	case _PUSHI:
+	case _JCMP_I:
+	case _ARITH_I:
 	    TRACE(("\tCELL *%p\n", p->ptr));
 	    break;
 	case _PUSHD:
+	case _JCMP_D:
+	case _ARITH_D:
 	    TRACE(("\tdouble *%p\n", p->ptr));
 	    break;
 	case _PUSHS:
@@ -224,6 +234,22 @@ TraceInst(INST * p, INST * base)
 	case _TEST:
 	case _UMINUS:
 	case _UPLUS:
+	case _ASSIGN_POP:
+	case _ADD_ASG_POP:
+	case D_ADD:
+	case D_SUB:
+	case D_MUL:
+	case D_DIV:
+	case D_MOD:
+	case D_POW:
+	case D_EQ:
+	case D_NEQ:
+	case D_LT:
+	case D_LTE:
+	case D_GT:
+	case D_GTE:
+	case _ICALL:
+	case _IRET:
 	    break;
 	}
     }
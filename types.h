@@ -35,6 +35,7 @@ typedef enum {
     ,C_SNULL			/* split on the empty string  */
     ,C_REPL			/* a replacement string   '\&' changed to &  */
     ,C_REPLV			/* a vector replacement -- broken on &  */
+    ,C_PAIR			/* a[i,j] integer subscripts, from array_cat() */
     ,NUM_CELL_TYPES
 } MAWK_CELL_TYPES;
 
@@ -64,6 +65,7 @@ typedef struct _string
 {
     size_t len;
     unsigned ref_cnt;
+    unsigned hval;		/* cached hash2() of str, or 0 */
     char str[2];
 }
 #endif
@@ -71,7 +73,7 @@ STRING;
 
 /* number of bytes more than the characters to store a
    string */
-#define  STRING_OH   (sizeof(STRING)-1)
+#define  STRING_OH   (offsetof(STRING, str) + 1)
 
 typedef unsigned short VCount;
 
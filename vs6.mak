@@ -27,7 +27,7 @@ OBJ1 =	parse.obj array.obj bi_funct.obj bi_vars.obj cast.obj code.obj \
 OBJ2 =	field.obj files.obj fin.obj hash.obj jmp.obj init.obj \
 	kw.obj main.obj matherr.obj
 
-OBJ3 =	memory.obj print.obj re_cmpl.obj scan.obj scancode.obj split.obj \
+OBJ3 =	memory.obj print.obj re_cmpl.obj scan.obj scancode.obj spill.obj split.obj \
 	zmalloc.obj version.obj regexp.obj dosexec.obj
 
 MAWK_OBJ = $(OBJ1) $(OBJ2) $(OBJ3)
@@ -85,7 +85,7 @@ distclean : clean
 	-del config.h
 
 #  dependencies of .objs on .h
-array.obj : array.h bi_vars.h config.h field.h mawk.h memory.h nstd.h sizes.h symtype.h types.h zmalloc.h
+array.obj : array.h bi_vars.h code.h config.h field.h mawk.h memory.h nstd.h sizes.h spill.h symtype.h types.h zmalloc.h
 bi_funct.obj : array.h bi_funct.h bi_vars.h config.h field.h files.h fin.h init.h mawk.h memory.h nstd.h regexp.h repl.h sizes.h symtype.h types.h zmalloc.h
 bi_vars.obj : array.h bi_vars.h config.h field.h init.h mawk.h memory.h nstd.h sizes.h symtype.h types.h zmalloc.h
 cast.obj : array.h config.h field.h mawk.h memory.h nstd.h parse.h repl.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
@@ -109,6 +109,7 @@ parse.obj : array.h bi_funct.h bi_vars.h code.h config.h field.h files.h jmp.h m
 print.obj : array.h bi_funct.h bi_vars.h config.h field.h files.h mawk.h memory.h nstd.h parse.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
 re_cmpl.obj : array.h config.h mawk.h memory.h nstd.h parse.h regexp.h repl.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
 scan.obj : array.h code.h config.h field.h files.h fin.h init.h mawk.h memory.h nstd.h parse.h repl.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
+spill.obj : array.h config.h mawk.h memory.h nstd.h sizes.h spill.h types.h zmalloc.h
 split.obj : array.h bi_funct.h bi_vars.h config.h field.h mawk.h memory.h nstd.h parse.h regexp.h repl.h scan.h scancode.h sizes.h symtype.h types.h zmalloc.h
 version.obj : array.h config.h init.h mawk.h nstd.h patchlev.h sizes.h symtype.h types.h
 zmalloc.obj : config.h mawk.h nstd.h sizes.h types.h zmalloc.h